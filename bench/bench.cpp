@@ -0,0 +1,859 @@
+/****************************************************************
+ * @file
+ * @brief Benchmark of all algorithms and data structures
+ * @details
+ * Runs every sort, search and data structure of the repository over a grid
+ * of sizes and input distributions and reports ns/op, throughput and, where
+ * perf_event_open works, cache misses per operation.
+ *
+ * Usage: bench [--json FILE] [--label TEXT] [--filter TEXT] [--max-size N]
+ *              [--epoch-ms MS] [--epochs N] [--quick]
+ * --json writes the results to FILE ("-" for stdout), --label is stored in
+ * the JSON (e.g. the commit hash), --filter runs only the benchmarks whose
+ * name and parameters contain TEXT, e.g. "pdq_sort" or "n=16384",
+ * --quick is --max-size 16384 --epochs 3.
+****************************************************************/
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <numeric>
+#include <optional>
+#include <random>
+#include <span>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "bench.h"
+
+#include "batch_search_function.h"
+#include "binary_search.h"
+#include "exponential_search.h"
+#include "eytzinger_search.h"
+#include "golden_section_search.h"
+#include "interpolation_search.h"
+#include "learned_index.h"
+#include "s_tree_search.h"
+#include "simd_search.h"
+#include "ternary_search.h"
+
+#include "argsort.h"
+#include "binary_insertion_sort.h"
+#include "bubble_sort.h"
+#include "external_sort.h"
+#include "heap_sort.h"
+#include "insertion_sort.h"
+#include "parallel_sort.h"
+#include "partial_sort.h"
+#include "pdq_sort.h"
+#include "radix_sort.h"
+#include "selection_sort.h"
+#include "sorting_network.h"
+#include "tim_sort.h"
+
+#include "aho_corasick.h"
+#include "binary_heap.h"
+#include "block_sparse_table.h"
+#include "circular_queue.h"
+#include "dawg.h"
+#include "dsu.h"
+#include "dynamic_segment_tree.h"
+#include "fenwick_tree.h"
+#include "multi_queue.h"
+#include "persistent_segment_tree.h"
+#include "segment_tree.h"
+#include "snapshot.h"
+#include "sparse_table.h"
+#include "sparse_table_2d.h"
+#include "trie.h"
+
+namespace {
+    constexpr std::size_t QUADRATIC_MAX_SIZE = 1 << 12;  // largest input of O(n^2) sorts
+    constexpr std::size_t QUERIES = 1 << 14;  // queries per run of search and data structure benchmarks
+    constexpr std::size_t TOP_K = 100;  // k of partial_sort and top_k
+
+    /**
+     * @brief Generate an input array
+     * @param n - size
+     * @param distribution - random, sorted, reversed, nearly_sorted or few_unique
+     */
+    std::vector<std::int32_t> generate(std::size_t n, const std::string &distribution, std::mt19937_64 &rng) {
+        std::vector<std::int32_t> arr(n);
+        for (auto &x : arr)
+            x = (std::int32_t) rng();
+        if (distribution == "few_unique")
+            for (auto &x : arr)
+                x &= 15;
+        else if (distribution != "random") {
+            std::sort(arr.begin(), arr.end());
+            if (distribution == "reversed")
+                std::reverse(arr.begin(), arr.end());
+            else if (distribution == "nearly_sorted")
+                for (std::size_t i = 0; i < n / 100; i++)
+                    std::swap(arr[rng() % n], arr[rng() % n]);
+        }
+        return arr;
+    }
+
+    bool less_int(std::int32_t a, std::int32_t b) {return a < b;}
+
+    std::int32_t sum_int(std::int32_t a, std::int32_t b) {return a + b;}
+
+    std::int32_t min_int(std::int32_t a, std::int32_t b) {return std::min(a, b);}
+
+    double cube(double x) {return x * x * x;}
+
+    double parabola(double x) {return -(x - 1) * (x - 1);}
+
+    bool less_int64(std::int64_t a, std::int64_t b) {return a < b;}
+
+    /**
+     * @brief BinaryHeap behind one lock, the queue MultiQueue replaces
+     */
+    class LockedHeap {
+        std::mutex mutex;
+        BinaryHeap<std::int64_t> heap;
+
+    public:
+        explicit LockedHeap(std::vector<std::int64_t> &arr) : heap(arr, less_int64) {}
+
+        void push(std::int64_t val) {
+            std::lock_guard lock(mutex);
+            heap.add(val);
+        }
+
+        std::optional<std::int64_t> pop() {
+            std::lock_guard lock(mutex);
+            if (heap.size() == 0)
+                return std::nullopt;
+            return heap.pop();
+        }
+    };
+
+    /**
+     * @brief Push or pop of the hold model
+     */
+    struct HoldEvent {
+        std::uint64_t seq;  // global order of the events
+        std::int64_t key;
+        bool pop;
+    };
+
+    /**
+     * @brief Hold model: every thread pops an element and pushes a later one, as a scheduler that runs a task
+     * and schedules the next one
+     * @param queue - priority queue, min first
+     * @param threads - number of threads
+     * @param ops - pops over all threads
+     * @param log - if not null, (*log)[t] gets the events of thread t
+     */
+    template <typename Queue>
+    void hold(Queue &queue, int threads, std::size_t ops, std::vector<std::vector<HoldEvent>> *log = nullptr) {
+        std::atomic<std::uint64_t> seq{0};
+        std::vector<std::thread> workers;
+        for (int t = 0; t < threads; t++)
+            workers.emplace_back([&, t] {
+                std::uint64_t step = 0x9E3779B97F4A7C15 * (t + 1);
+                for (std::size_t i = t; i < ops; i += threads) {
+                    std::optional<std::int64_t> key = queue.pop();
+                    if (!key)
+                        continue;
+                    if (log)
+                        (*log)[t].push_back({seq.fetch_add(1), *key, true});
+                    step ^= step << 13;
+                    step ^= step >> 7;
+                    step ^= step << 17;
+                    std::int64_t next = *key + 1 + (std::int64_t) (step % 1024);
+                    // the sequence number is taken before the push, so a push is logged before its pop
+                    if (log)
+                        (*log)[t].push_back({seq.fetch_add(1), next, false});
+                    queue.push(next);
+                }
+            });
+        for (auto &worker : workers)
+            worker.join();
+    }
+
+    /**
+     * @brief Mean rank error of the pops of a hold model run
+     * @details the events are replayed in the order of their sequence numbers, and every pop counts the
+     * elements in the queue that are better than the popped one
+     * @param initial - elements in the queue before the run
+     * @param log - events of every thread
+     */
+    double rank_error(const std::vector<std::int64_t> &initial, const std::vector<std::vector<HoldEvent>> &log) {
+        std::vector<HoldEvent> events;
+        for (auto &part : log)
+            events.insert(events.end(), part.begin(), part.end());
+        std::sort(events.begin(), events.end(), [](const HoldEvent &a, const HoldEvent &b) {return a.seq < b.seq;});
+        std::vector<std::int64_t> keys = initial;
+        for (auto &e : events)
+            keys.push_back(e.key);
+        std::sort(keys.begin(), keys.end());
+        keys.erase(std::unique(keys.begin(), keys.end()), keys.end());
+        auto index = [&](std::int64_t key) {
+            return (int) (std::lower_bound(keys.begin(), keys.end(), key) - keys.begin());
+        };
+        FenwickTree<int> present((int) keys.size());
+        for (auto key : initial)
+            present.add(index(key), 1);
+        double total = 0;
+        std::size_t pops = 0;
+        for (auto &e : events) {
+            int i = index(e.key);
+            if (e.pop) {
+                total += present.prefix_query(i - 1);
+                pops++;
+            }
+            present.add(i, e.pop ? -1 : 1);
+        }
+        return pops ? total / (double) pops : 0;
+    }
+
+    /**
+     * @brief Benchmarks of the sorting algorithms
+     */
+    void bench_sorting(Bench &bench, const std::vector<std::size_t> &sizes, std::mt19937_64 &rng) {
+        WorkStealingPool pool(std::max(1u, std::thread::hardware_concurrency()));
+        for (std::size_t n : sizes)
+            for (const std::string distribution : {"random", "sorted", "reversed", "nearly_sorted", "few_unique"}) {
+                std::vector<std::int32_t> input = generate(n, distribution, rng);
+                Bench::Params params = {{"n", std::to_string(n)}, {"distribution", distribution}};
+                double bytes = (double) (n * sizeof(std::int32_t));
+                auto copy = [&input] {return input;};
+                auto sort = [&](const std::string &name, auto f) {
+                    bench.run(name, params, (double) n, bytes, copy, f);
+                };
+                using Vec = std::vector<std::int32_t>;
+
+                if (n <= QUADRATIC_MAX_SIZE) {
+                    sort("bubble_sort", [](Vec &a) {bubble_sort(a, less_int);});
+                    sort("selection_sort", [](Vec &a) {selection_sort(a, less_int);});
+                    sort("insertion_sort", [](Vec &a) {insertion_sort(a, std::less<>());});
+                    sort("binary_insertion_sort", [](Vec &a) {binary_insertion_sort(a, std::less<>());});
+                }
+                sort("sorting_network_sort/blocks_of_64", [](Vec &a) {
+                    for (std::size_t left = 0; left < a.size(); left += 64)
+                        sorting_network_sort(a, left, std::min(a.size(), left + 64), std::less<>());
+                });
+                sort("heap_sort", [](Vec &a) {heap_sort(a, std::less<>());});
+                sort("pdq_sort", [](Vec &a) {pdq_sort(a, std::less<>());});
+                sort("radix_sort", [](Vec &a) {radix_sort(a);});
+                sort("tim_sort", [](Vec &a) {tim_sort(a, std::less<>());});
+                sort("parallel_sort", [&pool](Vec &a) {parallel_sort(a, std::less<>(), pool);});
+                sort("parallel_sort/stable", [&pool](Vec &a) {parallel_sort(a, std::less<>(), pool, true);});
+                sort("std::sort", [](Vec &a) {std::sort(a.begin(), a.end());});
+                sort("std::stable_sort", [](Vec &a) {std::stable_sort(a.begin(), a.end());});
+                sort("argsort", [](Vec &a) {do_not_optimize(argsort(a, std::less<>()));});
+                sort("sort_by_key", [](Vec &a) {sort_by_key(a, std::greater<>());});
+
+                Bench::Params k_params = params;
+                k_params.emplace_back("k", std::to_string(TOP_K));
+                bench.run("partial_sort", k_params, (double) n, bytes, copy, [](Vec &a) {
+                    partial_sort(a, TOP_K, std::less<>());
+                });
+                bench.run("top_k", k_params, (double) n, bytes, copy, [](Vec &a) {
+                    do_not_optimize(top_k(a.begin(), a.end(), TOP_K, std::less<>()));
+                });
+                bench.run("nth_element", params, (double) n, bytes, copy, [](Vec &a) {
+                    nth_element(a, a.size() / 2, std::less<>());
+                });
+
+                // the file is written in the setup, memory allows 4 runs
+                if (distribution == "random" && n >= (1 << 14)) {
+                    auto dir = std::filesystem::temp_directory_path();
+                    auto path = dir / ("bench_external_sort_" + std::to_string(n) + ".bin");
+                    bench.run("external_sort", params, (double) n, bytes, [&] {
+                        std::ofstream file(path, std::ios::binary);
+                        file.write(reinterpret_cast<const char *>(input.data()), (std::streamsize) bytes);
+                        return 0;
+                    }, [&](int) {
+                        external_sort<std::int32_t>(path, path, std::less<>(), n * sizeof(std::int32_t) / 2, dir);
+                    });
+                    std::filesystem::remove(path);
+                }
+            }
+    }
+
+    /**
+     * @brief Benchmarks of the search algorithms
+     */
+    void bench_search(Bench &bench, const std::vector<std::size_t> &sizes, std::mt19937_64 &rng) {
+        for (std::size_t n : sizes)
+            for (const std::string distribution : {"uniform", "exponential"}) {
+                std::vector<std::int64_t> arr(n);
+                for (auto &x : arr)
+                    x = distribution == "uniform"
+                        ? (std::int64_t) (rng() >> 2)
+                        : (std::int64_t) std::exp(std::uniform_real_distribution<double>(0, 40)(rng));
+                std::sort(arr.begin(), arr.end());
+                std::vector<std::int64_t> queries(QUERIES);
+                for (auto &q : queries)
+                    q = arr[rng() % n];
+                Bench::Params params = {{"n", std::to_string(n)}, {"distribution", distribution}};
+                auto search = [&](const std::string &name, auto f) {
+                    bench.run(name, params, (double) QUERIES, 0, [&] {
+                        std::int64_t checksum = 0;
+                        for (auto &q : queries)
+                            checksum += (std::int64_t) f(q);
+                        do_not_optimize(checksum);
+                    });
+                };
+
+                search("binary_search", [&](std::int64_t x) {return binary_search(arr, x);});
+                search("ternary_search", [&](std::int64_t x) {return ternary_search(arr, x);});
+                search("interpolation_search", [&](std::int64_t x) {return interpolation_search(arr, x);});
+                search("exponential_search", [&](std::int64_t x) {return exponential_search(arr, x);});
+                search("simd_search", [&](std::int64_t x) {return simd_search(arr, x);});
+                search("std::lower_bound", [&](std::int64_t x) {
+                    return std::lower_bound(arr.begin(), arr.end(), x) - arr.begin();
+                });
+                EytzingerSearch<std::int64_t> eytzinger(arr);
+                search("eytzinger_search", [&](std::int64_t x) {return eytzinger.lower_bound(x);});
+                STreeSearch<std::int64_t> s_tree(arr);
+                search("s_tree_search", [&](std::int64_t x) {return s_tree.lower_bound(x);});
+                LearnedIndex<std::int64_t> learned(arr);
+                search("learned_index", [&](std::int64_t x) {return learned.lower_bound(x);});
+            }
+
+        // searches on functions, n is the number of problems
+        for (std::size_t n : sizes) {
+            Bench::Params params = {{"n", std::to_string(n)}};
+            std::vector<double> val(n), left(n, -100.0), right(n, 100.0), res(n);
+            for (auto &v : val)
+                v = std::uniform_real_distribution<double>(-1e5, 1e5)(rng);
+            bench.run("binary_search_function", params, (double) n, 0, [&] {
+                for (std::size_t i = 0; i < n; i++)
+                    res[i] = binary_search_function(cube, val[i], -100.0, 100.0);
+                do_not_optimize(res);
+            });
+            bench.run("batch_binary_search_function", params, (double) n, 0, [&] {
+                batch_binary_search_function<double>(cube, val, left, right, res);
+                do_not_optimize(res);
+            });
+            bench.run("golden_section_search", params, (double) n, 0, [&] {
+                for (std::size_t i = 0; i < n; i++)
+                    res[i] = golden_section_search(parabola, left[i], right[i], 1e-6);
+                do_not_optimize(res);
+            });
+            bench.run("ternary_search_function", params, (double) n, 0, [&] {
+                for (std::size_t i = 0; i < n; i++)
+                    res[i] = ternary_search_function(parabola, left[i], right[i], 1e-6);
+                do_not_optimize(res);
+            });
+            bench.run("batch_golden_section_search", params, (double) n, 0, [&] {
+                batch_golden_section_search<double>(parabola, left, right, res);
+                do_not_optimize(res);
+            });
+        }
+    }
+
+    /**
+     * @brief Benchmarks of the data structures
+     */
+    void bench_data_structures(Bench &bench, const std::vector<std::size_t> &sizes, std::mt19937_64 &rng) {
+        for (std::size_t n : sizes) {
+            Bench::Params params = {{"n", std::to_string(n)}};
+            std::vector<std::int32_t> arr = generate(n, "random", rng);
+            for (auto &x : arr)
+                x &= 0xffff;
+            std::vector<std::pair<int, int>> ranges(QUERIES);
+            for (auto &[l, r] : ranges) {
+                l = (int) (rng() % n);
+                r = (int) (rng() % n);
+                if (l > r)
+                    std::swap(l, r);
+            }
+            double bytes = (double) (n * sizeof(std::int32_t));
+
+            bench.run("segment_tree/build", params, (double) n, bytes, [&] {
+                SegmentTree<std::int32_t> tree(arr, sum_int);
+                do_not_optimize(tree);
+            });
+            SegmentTree<std::int32_t> tree(arr, sum_int);
+            bench.run("segment_tree/query", params, (double) QUERIES, 0, [&] {
+                std::int32_t checksum = 0;
+                for (auto &[l, r] : ranges)
+                    checksum += tree.query(l, r);
+                do_not_optimize(checksum);
+            });
+            bench.run("segment_tree/update", params, (double) QUERIES, 0, [&] {
+                for (auto &[l, r] : ranges)
+                    tree.update(l, r);
+            });
+            // first index where the sum from l reaches r, by descent and by binary search over query
+            bench.run("segment_tree/max_right", params, (double) QUERIES, 0, [&] {
+                int checksum = 0;
+                for (auto &[l, r] : ranges)
+                    checksum += tree.max_right(l, [x = r](std::int32_t s) {return s < x;});
+                do_not_optimize(checksum);
+            });
+            bench.run("segment_tree/max_right_by_query", params, (double) QUERIES, 0, [&] {
+                int checksum = 0;
+                for (auto &[l, r] : ranges) {
+                    int lo = l, hi = (int) n;
+                    while (lo < hi) {
+                        int mid = (lo + hi) / 2;
+                        if (tree.query(l, mid) < r)
+                            lo = mid + 1;
+                        else
+                            hi = mid;
+                    }
+                    checksum += lo;
+                }
+                do_not_optimize(checksum);
+            });
+
+            // the same sums with Fenwick trees
+            bench.run("fenwick_tree/build", params, (double) n, bytes, [&] {
+                FenwickTree<std::int32_t> fenwick(arr);
+                do_not_optimize(fenwick);
+            });
+            FenwickTree<std::int32_t> fenwick(arr);
+            bench.run("fenwick_tree/query", params, (double) QUERIES, 0, [&] {
+                std::int32_t checksum = 0;
+                for (auto &[l, r] : ranges)
+                    checksum += fenwick.query(l, r);
+                do_not_optimize(checksum);
+            });
+            bench.run("fenwick_tree/add", params, (double) QUERIES, 0, [&] {
+                for (auto &[l, r] : ranges)
+                    fenwick.add(l, r);
+            });
+            bench.run("fenwick_tree/lower_bound", params, (double) QUERIES, 0, [&] {
+                int checksum = 0;
+                for (auto &[l, r] : ranges)
+                    checksum += fenwick.lower_bound(r);
+                do_not_optimize(checksum);
+            });
+            RangeFenwickTree<std::int64_t> range_fenwick((int) n);
+            bench.run("range_fenwick_tree/range_add", params, (double) QUERIES, 0, [&] {
+                for (auto &[l, r] : ranges)
+                    range_fenwick.range_add(l, r, 1);
+            });
+            bench.run("range_fenwick_tree/query", params, (double) QUERIES, 0, [&] {
+                std::int64_t checksum = 0;
+                for (auto &[l, r] : ranges)
+                    checksum += range_fenwick.query(l, r);
+                do_not_optimize(checksum);
+            });
+            int side = (int) std::sqrt((double) n);
+            FenwickTree2D<std::int32_t> fenwick_2d(side, side);
+            bench.run("fenwick_tree_2d/add_query", params, (double) QUERIES, 0, [&] {
+                std::int32_t checksum = 0;
+                for (auto &[l, r] : ranges) {
+                    fenwick_2d.add(l % side, r % side, 1);
+                    checksum += fenwick_2d.query(0, 0, r % side, l % side);
+                }
+                do_not_optimize(checksum);
+            });
+
+            // n points spread over [0, 1e18]
+            const std::int64_t universe = 1000000000000000000LL;
+            std::vector<std::int64_t> points(n);
+            for (auto &p : points)
+                p = (std::int64_t) (rng() % (std::uint64_t) universe);
+            bench.run("dynamic_segment_tree/update", params, (double) n, 0, [&] {
+                return DynamicSegmentTree<std::int64_t>(0, universe, [](std::int64_t a, std::int64_t b) {
+                    return a + b;
+                }, 0, n);
+            }, [&](DynamicSegmentTree<std::int64_t> &dynamic) {
+                for (auto p : points)
+                    dynamic.update(p, 1);
+            });
+            DynamicSegmentTree<std::int64_t> dynamic(0, universe, [](std::int64_t a, std::int64_t b) {
+                return a + b;
+            }, 0, n);
+            for (auto p : points)
+                dynamic.update(p, 1);
+            bench.run("dynamic_segment_tree/query", params, (double) QUERIES, 0, [&] {
+                std::int64_t checksum = 0;
+                for (std::size_t i = 0; i < QUERIES; i++) {
+                    std::int64_t l = points[i % n], r = points[(i * 7 + 1) % n];
+                    checksum += dynamic.query(std::min(l, r), std::max(l, r));
+                }
+                do_not_optimize(checksum);
+            });
+
+            bench.run("persistent_segment_tree/update", params, (double) QUERIES, 0, [&] {
+                return PersistentSegmentTree<std::int32_t>(arr, sum_int, QUERIES);
+            }, [&](PersistentSegmentTree<std::int32_t> &persistent) {
+                for (auto &[l, r] : ranges)
+                    persistent.update(l, r);
+            });
+            PersistentSegmentTree<std::int32_t> persistent(arr, sum_int, QUERIES);
+            for (auto &[l, r] : ranges)
+                persistent.update(l, r);
+            bench.run("persistent_segment_tree/query", params, (double) QUERIES, 0, [&] {
+                std::int32_t checksum = 0;
+                for (auto &[l, r] : ranges)
+                    checksum += persistent.query((int) (l % (persistent.latest() + 1)), l, r);
+                do_not_optimize(checksum);
+            });
+
+            SparseTable<std::int32_t> table(arr, min_int);
+            bench.set_memory((double) table.memory());
+            bench.run("sparse_table/build", params, (double) n, bytes, [&] {
+                SparseTable<std::int32_t> table(arr, min_int);
+                do_not_optimize(table);
+            });
+            bench.run("sparse_table/query", params, (double) QUERIES, 0, [&] {
+                std::int32_t checksum = 0;
+                for (auto &[l, r] : ranges)
+                    checksum += table.query(l, r);
+                do_not_optimize(checksum);
+            });
+            BlockSparseTable<std::int32_t> block_table(arr, min_int);
+            bench.set_memory((double) block_table.memory());
+            bench.run("block_sparse_table/build", params, (double) n, bytes, [&] {
+                BlockSparseTable<std::int32_t> block_table(arr, min_int);
+                do_not_optimize(block_table);
+            });
+            bench.run("block_sparse_table/query", params, (double) QUERIES, 0, [&] {
+                std::int32_t checksum = 0;
+                for (auto &[l, r] : ranges)
+                    checksum += block_table.query(l, r);
+                do_not_optimize(checksum);
+            });
+
+            // side x side grid, rectangles from the same ranges
+            int grid_side = (int) std::sqrt((double) n);
+            std::vector<std::vector<std::int32_t>> grid(grid_side);
+            for (int r = 0; r < grid_side; r++)
+                grid[r].assign(arr.begin() + (std::ptrdiff_t) r * grid_side,
+                               arr.begin() + (std::ptrdiff_t) (r + 1) * grid_side);
+            std::vector<std::array<int, 4>> rects(QUERIES);
+            for (std::size_t i = 0; i < QUERIES; i++) {
+                auto [l, r] = ranges[i];
+                auto [l2, r2] = ranges[(i + 1) % QUERIES];
+                rects[i] = {l % grid_side, l2 % grid_side, r % grid_side, r2 % grid_side};
+                if (rects[i][0] > rects[i][2])
+                    std::swap(rects[i][0], rects[i][2]);
+                if (rects[i][1] > rects[i][3])
+                    std::swap(rects[i][1], rects[i][3]);
+            }
+            std::vector<SparseTable<std::int32_t>> row_tables;
+            for (auto &row : grid)
+                row_tables.emplace_back(row, min_int);
+            bench.run("sparse_table/rows_query", params, (double) QUERIES, 0, [&] {
+                std::int32_t checksum = 0;
+                for (auto &[r1, c1, r2, c2] : rects) {
+                    std::int32_t res = row_tables[r1].query(c1, c2);
+                    for (int r = r1 + 1; r <= r2; r++)
+                        res = std::min(res, row_tables[r].query(c1, c2));
+                    checksum += res;
+                }
+                do_not_optimize(checksum);
+            });
+            for (bool square_only : {false, true}) {
+                std::string name = square_only ? "sparse_table_2d_squares" : "sparse_table_2d";
+                SparseTable2D<std::int32_t> table_2d(grid, min_int, square_only);
+                bench.set_memory((double) table_2d.memory());
+                bench.run(name + "/build", params, (double) n, bytes, [&] {
+                    SparseTable2D<std::int32_t> table_2d(grid, min_int, square_only);
+                    do_not_optimize(table_2d);
+                });
+                bench.run(name + "/query", params, (double) QUERIES, 0, [&] {
+                    std::int32_t checksum = 0;
+                    for (auto &[r1, c1, r2, c2] : rects)
+                        checksum += table_2d.query(r1, c1, r2, c2);
+                    do_not_optimize(checksum);
+                });
+            }
+
+            bench.run("dsu/union_find", params, (double) QUERIES, 0, [&] {
+                return DSU<int>((int) n);
+            }, [&](DSU<int> &dsu) {
+                int checksum = 0;
+                for (auto &[l, r] : ranges) {
+                    dsu.union_sets(l, r);
+                    checksum += dsu.find_set(r);
+                }
+                do_not_optimize(checksum);
+            });
+
+            // cold start from a snapshot against a rebuild, the page cache keeps the file
+            auto snapshot_path = std::filesystem::temp_directory_path() / ("bench_snapshot_" + std::to_string(n));
+            table.save(snapshot_path);
+            bench.run("sparse_table/save", params, (double) n, bytes, [&] {
+                table.save(snapshot_path);
+            });
+#ifdef SNAPSHOT_VIEWS
+            bench.run("sparse_table/open_query", params, (double) QUERIES, 0, [&] {
+                SparseTableView<std::int32_t> view(snapshot_path, min_int);
+                std::int32_t checksum = 0;
+                for (auto &[l, r] : ranges)
+                    checksum += view.query(l, r);
+                do_not_optimize(checksum);
+            });
+            tree.save(snapshot_path);
+            bench.run("segment_tree/open_query", params, (double) QUERIES, 0, [&] {
+                SegmentTreeView<std::int32_t> view(snapshot_path, sum_int);
+                std::int32_t checksum = 0;
+                for (auto &[l, r] : ranges)
+                    checksum += view.query(l, r);
+                do_not_optimize(checksum);
+            });
+            DSU<int> dsu((int) n);
+            for (auto &[l, r] : ranges)
+                dsu.union_sets(l, r);
+            dsu.save(snapshot_path);
+            bench.run("dsu/open_find", params, (double) QUERIES, 0, [&] {
+                DSUView<int> view(snapshot_path);
+                int checksum = 0;
+                for (auto &[l, r] : ranges)
+                    checksum += view.find_set(r);
+                do_not_optimize(checksum);
+            });
+#endif
+            std::filesystem::remove(snapshot_path);
+
+            bench.run("binary_heap/build", params, (double) n, bytes, [&] {
+                BinaryHeap<std::int32_t> heap(arr, less_int);
+                do_not_optimize(heap);
+            });
+            bench.run("binary_heap/add", params, (double) n, bytes, [&] {
+                std::vector<std::int32_t> empty;
+                return BinaryHeap<std::int32_t>(empty, less_int);
+            }, [&](BinaryHeap<std::int32_t> &heap) {
+                for (auto x : arr)
+                    heap.add(x);
+            });
+            bench.run("binary_heap/pop", params, (double) n, bytes, [&] {
+                return BinaryHeap<std::int32_t>(arr, less_int);
+            }, [&](BinaryHeap<std::int32_t> &heap) {
+                std::int32_t checksum = 0;
+                for (std::size_t i = 0; i < n; i++)
+                    checksum += heap.pop();
+                do_not_optimize(checksum);
+            });
+
+            bench.run("circular_queue/add_remove", params, (double) n, bytes, [&] {
+                CircularQueue<std::int32_t> queue;
+                for (auto x : arr)
+                    queue.add(x);
+                std::int32_t checksum = 0;
+                while (!queue.is_empty())
+                    checksum += queue.remove();
+                do_not_optimize(checksum);
+            });
+
+            std::vector<std::string> words(n);
+            for (auto &w : words) {
+                w.resize(1 + rng() % 12);
+                for (auto &c : w)
+                    c = (char) ('a' + rng() % 26);
+            }
+            bench.run("trie/insert", params, (double) n, 0, [&] {
+                Trie trie;
+                for (auto &w : words)
+                    trie.insert(w);
+                do_not_optimize(trie);
+            });
+            Trie trie;
+            for (std::size_t i = 0; i < n; i += 2)
+                trie.insert(words[i]);
+            bench.run("trie/search", params, (double) n, 0, [&] {
+                int found = 0;
+                for (auto &w : words)
+                    found += trie.search(w);
+                do_not_optimize(found);
+            });
+
+            // the same strings in a DAWG, inflected forms of stems share their endings and random strings do not
+            std::vector<std::string> inflected;
+            while (inflected.size() < n) {
+                std::string stem(3 + rng() % 6, ' ');
+                for (auto &c : stem)
+                    c = (char) ('a' + rng() % 26);
+                for (auto suffix : {"", "s", "ed", "er", "ers", "ing", "ings", "ness"})
+                    inflected.push_back(stem + suffix);
+            }
+            for (auto [name, set] : {std::pair{"random", &words}, {"inflected", &inflected}}) {
+                Bench::Params set_params = params;
+                set_params.emplace_back("words", name);
+                std::vector<std::string> sorted = *set;
+                std::sort(sorted.begin(), sorted.end());
+                Trie set_trie;
+                for (auto &w : sorted)
+                    set_trie.insert(w);
+                bench.set_memory((double) set_trie.memory());
+                bench.run("trie/build", set_params, (double) sorted.size(), 0, [&] {
+                    Trie built;
+                    for (auto &w : sorted)
+                        built.insert(w);
+                    do_not_optimize(built);
+                });
+                Dawg dawg;
+                for (auto &w : sorted)
+                    dawg.insert(w);
+                dawg.finish();
+                bench.set_memory((double) dawg.memory());
+                bench.run("dawg/build", set_params, (double) sorted.size(), 0, [&] {
+                    Dawg built;
+                    for (auto &w : sorted)
+                        built.insert(w);
+                    built.finish();
+                    do_not_optimize(built);
+                });
+                bench.run("dawg/search", set_params, (double) set->size(), 0, [&] {
+                    int found = 0;
+                    for (auto &w : *set)
+                        found += dawg.search(w);
+                    do_not_optimize(found);
+                });
+            }
+
+            // n keywords in 1 MiB of text: random letters keep the automaton deep, log lines stay near the root
+            std::vector<std::string> keywords(n);
+            for (auto &w : keywords) {
+                w.resize(6 + rng() % 7);
+                for (auto &c : w)
+                    c = (char) ('a' + rng() % 26);
+            }
+            bench.run("aho_corasick/build", params, (double) n, 0, [&] {
+                AhoCorasick automaton;
+                for (auto &w : keywords)
+                    automaton.insert(w);
+                automaton.build();
+                do_not_optimize(automaton);
+            });
+            AhoCorasick automaton;
+            for (auto &w : keywords)
+                automaton.insert(w);
+            automaton.build();
+            std::string letters(1 << 20, ' '), log;
+            for (auto &c : letters)
+                c = (char) ('a' + rng() % 26);
+            while (log.size() < letters.size())
+                log += "2024-05-17T12:" + std::to_string(rng() % 60) + " INFO [WORKER-" + std::to_string(rng() % 64)
+                       + "] GET /API/V2/ITEMS/" + std::to_string(rng()) + " STATUS=200 user="
+                       + letters.substr(rng() % 1000, 8) + "\n";
+            for (auto [name, text] : {std::pair{"letters", &letters}, {"log", &log}}) {
+                Bench::Params text_params = params;
+                text_params.emplace_back("text", name);
+                bench.run("aho_corasick/feed", text_params, (double) text->size(), (double) text->size(), [&] {
+                    std::size_t matches = 0;
+                    automaton.reset();
+                    automaton.feed(*text, [&](int, std::size_t) {matches++;});
+                    do_not_optimize(matches);
+                });
+            }
+            // the approach it replaces: a trie lookup of every substring up to the longest keyword
+            Trie keyword_trie;
+            for (auto &w : keywords)
+                keyword_trie.insert(w);
+            std::string sample = letters.substr(0, 1 << 12);
+            Bench::Params sample_params = params;
+            sample_params.emplace_back("text", "letters");
+            bench.run("trie/substring_scan", sample_params, (double) sample.size(), (double) sample.size(), [&] {
+                std::size_t matches = 0;
+                for (std::size_t i = 0; i < sample.size(); i++)
+                    for (std::size_t len = 6; len <= 12 && i + len <= sample.size(); len++)
+                        matches += keyword_trie.search(sample.substr(i, len));
+                do_not_optimize(matches);
+            });
+        }
+    }
+
+    /**
+     * @brief Benchmarks of the concurrent priority queues, throughput and rank error over thread counts
+     */
+    void bench_concurrent_queues(Bench &bench, const std::vector<std::size_t> &sizes) {
+        std::vector<int> thread_counts;
+        for (int threads = 1; threads <= (int) std::max(4u, std::thread::hardware_concurrency()); threads *= 2)
+            thread_counts.push_back(threads);
+        for (std::size_t n : sizes)
+            for (int threads : thread_counts) {
+                Bench::Params params = {{"n", std::to_string(n)}, {"threads", std::to_string(threads)}};
+                std::vector<std::int64_t> initial(n);
+                std::iota(initial.begin(), initial.end(), 0);
+                MultiQueue<std::int64_t> multi_queue(threads, less_int64);
+                for (auto key : initial)
+                    multi_queue.push(key);
+                // the rank error is measured on a run with a log, the timed runs do not log
+                MultiQueue<std::int64_t> logged(threads, less_int64);
+                for (auto key : initial)
+                    logged.push(key);
+                std::vector<std::vector<HoldEvent>> log(threads);
+                hold(logged, threads, QUERIES, &log);
+                bench.set_rank_error(rank_error(initial, log));
+                bench.run("multi_queue/hold", params, (double) QUERIES, 0, [&] {
+                    hold(multi_queue, threads, QUERIES);
+                });
+                LockedHeap locked_heap(initial);
+                bench.run("locked_heap/hold", params, (double) QUERIES, 0, [&] {
+                    hold(locked_heap, threads, QUERIES);
+                });
+            }
+    }
+}
+
+int main(int argc, char **argv) {
+    std::string json, label, filter;
+    std::size_t max_size = 1 << 18;
+    std::size_t epochs = 5;
+    double epoch_ms = 10;
+    for (int i = 1; i < argc; i++) {
+        std::string arg = argv[i];
+        auto value = [&]() -> std::string {
+            if (i + 1 == argc) {
+                std::cerr << "Missing value of " << arg << std::endl;
+                std::exit(1);
+            }
+            return argv[++i];
+        };
+        if (arg == "--json")
+            json = value();
+        else if (arg == "--label")
+            label = value();
+        else if (arg == "--filter")
+            filter = value();
+        else if (arg == "--max-size")
+            max_size = std::stoull(value());
+        else if (arg == "--epochs")
+            epochs = std::stoull(value());
+        else if (arg == "--epoch-ms")
+            epoch_ms = std::stod(value());
+        else if (arg == "--quick") {
+            max_size = 1 << 14;
+            epochs = 3;
+        }
+        else {
+            std::cerr << "Unknown argument " << arg << std::endl;
+            return 1;
+        }
+    }
+
+    std::vector<std::size_t> sizes;
+    for (std::size_t n = 1 << 10; n <= max_size; n <<= 4)
+        sizes.push_back(n);
+    Bench bench(std::chrono::nanoseconds((long long) (epoch_ms * 1e6)), epochs, filter);
+    if (!bench.has_counters())
+        std::cout << "Hardware counters are not available, cache misses are not reported" << std::endl;
+    std::mt19937_64 rng(42);
+    bench_sorting(bench, sizes, rng);
+    bench_search(bench, sizes, rng);
+    bench_data_structures(bench, sizes, rng);
+    bench_concurrent_queues(bench, sizes);
+
+    if (json == "-")
+        bench.write_json(std::cout, label);
+    else if (!json.empty()) {
+        std::ofstream file(json);
+        bench.write_json(file, label);
+        std::cout << "Results are written to " << json << std::endl;
+    }
+    return 0;
+}
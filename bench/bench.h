@@ -0,0 +1,383 @@
+/****************************************************************
+ * @file
+ * @brief Benchmark harness
+ * @details
+ * A small self-contained harness in the spirit of nanobench:
+ * 1) A benchmark is a setup function and a run function. Only the run is
+ * timed, so sorts get a fresh copy of their input every iteration.
+ * 2) Iterations are repeated until an epoch lasts long enough for the
+ * clock, and the result is the median of several epochs, with the median
+ * absolute deviation as its error.
+ * 3) On Linux, cache misses, branch misses and instructions are counted
+ * with perf_event_open around the run function. If the kernel does not
+ * allow it (perf_event_paranoid, containers, virtual machines without a
+ * PMU) the counters are reported as null.
+ * 4) Results are printed as a table and can be written as JSON to diff
+ * runs across commits.
+****************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <ctime>
+#include <iomanip>
+#include <iostream>
+#include <ostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#ifdef __linux__
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace bench_detail {
+    constexpr std::size_t COUNTERS = 3;  // cache misses, branch misses, instructions
+    constexpr const char *COUNTER_NAMES[COUNTERS] = {"cache_misses", "branch_misses", "instructions"};
+
+    /**
+     * @brief Escape a string for JSON
+     */
+    inline std::string json_string(const std::string &s) {
+        std::string res = "\"";
+        for (char c : s) {
+            if (c == '"' || c == '\\')
+                res += '\\';
+            if ((unsigned char) c < 0x20) {
+                char code[8];
+                std::snprintf(code, sizeof(code), "\\u%04x", (unsigned) (unsigned char) c);
+                res += code;
+                continue;
+            }
+            res += c;
+        }
+        return res + "\"";
+    }
+
+    /**
+     * @brief Format a number for JSON, NaN becomes null
+     */
+    inline std::string json_number(double x) {
+        if (!std::isfinite(x))
+            return "null";
+        std::ostringstream os;
+        os << std::setprecision(9) << x;
+        return os.str();
+    }
+}
+
+/**
+ * @brief Do not let the compiler drop the computation of a value
+ */
+template <typename T>
+inline void do_not_optimize(const T &value) {
+    asm volatile("" : : "r,m"(value) : "memory");
+}
+
+/**
+ * @brief Hardware counters of the calling thread
+ */
+class PerfCounters {
+    int fds[bench_detail::COUNTERS] = {-1, -1, -1};
+    bool running = false;
+
+public:
+    PerfCounters() {
+#ifdef __linux__
+        const std::uint64_t configs[bench_detail::COUNTERS] = {
+            PERF_COUNT_HW_CACHE_MISSES, PERF_COUNT_HW_BRANCH_MISSES, PERF_COUNT_HW_INSTRUCTIONS,
+        };
+        for (std::size_t i = 0; i < bench_detail::COUNTERS; i++) {
+            perf_event_attr attr{};
+            attr.type = PERF_TYPE_HARDWARE;
+            attr.size = sizeof(attr);
+            attr.config = configs[i];
+            attr.disabled = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+            fds[i] = (int) syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+        }
+#endif
+    }
+
+    PerfCounters(const PerfCounters &) = delete;
+    PerfCounters &operator=(const PerfCounters &) = delete;
+
+    ~PerfCounters() {
+#ifdef __linux__
+        for (int fd : fds)
+            if (fd != -1)
+                close(fd);
+#endif
+    }
+
+    /**
+     * @brief Check if a counter could be opened
+     */
+    bool available(std::size_t i) const {
+        return fds[i] != -1;
+    }
+
+    /**
+     * @brief Check if any counter could be opened
+     */
+    bool any_available() const {
+        return std::any_of(std::begin(fds), std::end(fds), [](int fd) {return fd != -1;});
+    }
+
+    /**
+     * @brief Reset and start counting
+     */
+    void start() {
+#ifdef __linux__
+        for (int fd : fds)
+            if (fd != -1) {
+                ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+                ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+            }
+#endif
+        running = true;
+    }
+
+    /**
+     * @brief Stop counting and add the counts to values
+     */
+    void stop(double (&values)[bench_detail::COUNTERS]) {
+        if (!running)
+            return;
+        running = false;
+#ifdef __linux__
+        for (std::size_t i = 0; i < bench_detail::COUNTERS; i++)
+            if (fds[i] != -1) {
+                ioctl(fds[i], PERF_EVENT_IOC_DISABLE, 0);
+                std::uint64_t count = 0;
+                if (read(fds[i], &count, sizeof(count)) == (ssize_t) sizeof(count))
+                    values[i] += (double) count;
+            }
+#endif
+    }
+};
+
+/**
+ * @brief Result of one benchmark
+ */
+struct BenchResult {
+    std::string name;
+    std::vector<std::pair<std::string, std::string>> params;  // point of the grid, e.g. n and distribution
+    std::size_t iterations = 0;  // timed runs over all epochs
+    double ns_per_op = 0;  // median over epochs
+    double error = 0;  // median absolute deviation of ns_per_op over epochs, relative
+    double ops_per_second = 0;
+    double bytes_per_second = NAN;  // NaN if bytes were not given
+    double counters[bench_detail::COUNTERS] = {NAN, NAN, NAN};  // per op, NaN if not available
+    double memory_bytes = NAN;  // bytes held by the benchmarked structure, NaN if not given
+    double rank_error = NAN;  // mean rank error of the pops of a relaxed queue, NaN if not given
+
+    /**
+     * @brief Name and parameters as one string, used for filters
+     */
+    std::string full_name() const {
+        std::string res = name;
+        for (auto &[key, value] : params)
+            res += "/" + key + "=" + value;
+        return res;
+    }
+};
+
+/**
+ * @brief Benchmark runner
+ */
+class Bench {
+    std::vector<BenchResult> results;
+    PerfCounters counters;
+    std::chrono::nanoseconds epoch_time;
+    std::size_t epochs;
+    std::string filter;
+    double next_memory = NAN;  // memory of the next benchmark
+    double next_rank_error = NAN;  // rank error of the next benchmark
+
+public:
+    using Params = std::vector<std::pair<std::string, std::string>>;
+
+    /**
+     * @brief Constructor
+     * @param epoch_time - shortest time of one epoch
+     * @param epochs - number of epochs
+     * @param filter - only benchmarks whose full name contains it are run
+     */
+    explicit Bench(std::chrono::nanoseconds epoch_time = std::chrono::milliseconds(10), std::size_t epochs = 5,
+                   std::string filter = {})
+            : epoch_time(epoch_time), epochs(std::max<std::size_t>(epochs, 1)), filter(std::move(filter)) {}
+
+    /**
+     * @brief Check if the hardware counters work
+     */
+    bool has_counters() const {
+        return counters.any_available();
+    }
+
+    /**
+     * @brief Set the memory held by the structure of the next benchmark
+     * @param bytes - memory in bytes, reported with the next result
+     */
+    void set_memory(double bytes) {
+        next_memory = bytes;
+    }
+
+    /**
+     * @brief Set the rank error of the relaxed queue of the next benchmark
+     * @param error - mean number of better elements in the queue at a pop, reported with the next result
+     */
+    void set_rank_error(double error) {
+        next_rank_error = error;
+    }
+
+    /**
+     * @brief Run a benchmark with a setup that is not timed
+     * @param name - name of the benchmark
+     * @param params - point of the grid
+     * @param ops - operations done by one run, results are per operation
+     * @param bytes - bytes processed by one run, 0 if throughput in bytes makes no sense
+     * @param setup - returns the state for a run, e.g. a copy of the input
+     * @param run - timed function of the state
+     */
+    template <typename Setup, typename Run>
+    void run(const std::string &name, const Params &params, double ops, double bytes, Setup setup, Run run) {
+        BenchResult res;
+        res.name = name;
+        res.params = params;
+        res.memory_bytes = std::exchange(next_memory, NAN);
+        res.rank_error = std::exchange(next_rank_error, NAN);
+        if (!filter.empty() && res.full_name().find(filter) == std::string::npos)
+            return;
+        // warm up caches, the allocator and the branch predictor
+        {
+            auto state = setup();
+            run(state);
+            do_not_optimize(state);
+        }
+        std::vector<double> samples;
+        double totals[bench_detail::COUNTERS] = {0, 0, 0};
+        for (std::size_t e = 0; e < epochs; e++) {
+            std::chrono::nanoseconds elapsed{0};
+            std::size_t count = 0;
+            do {
+                auto state = setup();
+                counters.start();
+                auto start = std::chrono::steady_clock::now();
+                run(state);
+                auto end = std::chrono::steady_clock::now();
+                counters.stop(totals);
+                do_not_optimize(state);
+                elapsed += end - start;
+                count++;
+            } while (elapsed < epoch_time);
+            samples.push_back((double) elapsed.count() / (double) count / ops);
+            res.iterations += count;
+        }
+        std::sort(samples.begin(), samples.end());
+        res.ns_per_op = samples[samples.size() / 2];
+        std::vector<double> deviations;
+        for (double s : samples)
+            deviations.push_back(std::abs(s - res.ns_per_op));
+        std::sort(deviations.begin(), deviations.end());
+        res.error = res.ns_per_op > 0 ? deviations[deviations.size() / 2] / res.ns_per_op : 0;
+        res.ops_per_second = 1e9 / res.ns_per_op;
+        if (bytes > 0)
+            res.bytes_per_second = res.ops_per_second * bytes / ops;
+        for (std::size_t i = 0; i < bench_detail::COUNTERS; i++)
+            if (counters.available(i))
+                res.counters[i] = totals[i] / ((double) res.iterations * ops);
+        print(std::cout, res);
+        results.push_back(std::move(res));
+    }
+
+    /**
+     * @brief Run a benchmark without setup
+     */
+    template <typename Run>
+    void run(const std::string &name, const Params &params, double ops, double bytes, Run run) {
+        this->run(name, params, ops, bytes, [] {return 0;}, [&run](int) {run();});
+    }
+
+    /**
+     * @brief Get the results so far
+     */
+    const std::vector<BenchResult> &get_results() const {
+        return results;
+    }
+
+    /**
+     * @brief Print one result as a row of a table
+     */
+    static void print(std::ostream &os, const BenchResult &res) {
+        std::ostringstream row;
+        row << std::left << std::setw(60) << res.full_name() << std::right << std::fixed
+            << std::setprecision(2) << std::setw(12) << res.ns_per_op << " ns/op"
+            << std::setw(8) << std::setprecision(1) << res.error * 100 << "%"
+            << std::setw(12) << std::setprecision(2) << res.ops_per_second / 1e6 << " Mop/s";
+        if (std::isfinite(res.bytes_per_second))
+            row << std::setw(10) << res.bytes_per_second / (1 << 20) << " MiB/s";
+        if (std::isfinite(res.memory_bytes))
+            row << std::setw(10) << std::setprecision(2) << res.memory_bytes / (1 << 20) << " MiB";
+        if (std::isfinite(res.rank_error))
+            row << std::setw(10) << std::setprecision(1) << res.rank_error << " rank err";
+        if (std::isfinite(res.counters[0]))
+            row << std::setw(10) << std::setprecision(3) << res.counters[0] << " misses/op";
+        os << row.str() << std::endl;
+    }
+
+    /**
+     * @brief Write all results as JSON
+     * @param os - output stream
+     * @param label - free-form label of the run, e.g. a commit hash
+     */
+    void write_json(std::ostream &os, const std::string &label = {}) const {
+        using namespace bench_detail;
+        std::time_t now = std::time(nullptr);
+        char date[32];
+        std::strftime(date, sizeof(date), "%Y-%m-%dT%H:%M:%SZ", std::gmtime(&now));
+        os << "{\n  \"context\": {\n";
+        os << "    \"label\": " << json_string(label) << ",\n";
+        os << "    \"date\": " << json_string(date) << ",\n";
+#ifdef __VERSION__
+        os << "    \"compiler\": " << json_string(__VERSION__) << ",\n";
+#endif
+#ifdef NDEBUG
+        os << "    \"assertions\": false,\n";
+#else
+        os << "    \"assertions\": true,\n";
+#endif
+        os << "    \"epoch_ns\": " << epoch_time.count() << ",\n";
+        os << "    \"epochs\": " << epochs << ",\n";
+        os << "    \"perf_counters\": " << (has_counters() ? "true" : "false") << "\n  },\n";
+        os << "  \"benchmarks\": [";
+        for (std::size_t r = 0; r < results.size(); r++) {
+            const BenchResult &res = results[r];
+            os << (r ? ",\n" : "\n") << "    {\"name\": " << json_string(res.name) << ", \"params\": {";
+            for (std::size_t i = 0; i < res.params.size(); i++)
+                os << (i ? ", " : "") << json_string(res.params[i].first) << ": "
+                   << json_string(res.params[i].second);
+            os << "}, \"iterations\": " << res.iterations
+               << ", \"ns_per_op\": " << json_number(res.ns_per_op)
+               << ", \"error\": " << json_number(res.error)
+               << ", \"ops_per_second\": " << json_number(res.ops_per_second)
+               << ", \"bytes_per_second\": " << json_number(res.bytes_per_second)
+               << ", \"memory_bytes\": " << json_number(res.memory_bytes)
+               << ", \"rank_error\": " << json_number(res.rank_error);
+            for (std::size_t i = 0; i < COUNTERS; i++)
+                os << ", \"" << COUNTER_NAMES[i] << "_per_op\": " << json_number(res.counters[i]);
+            os << "}";
+        }
+        os << "\n  ]\n}\n";
+    }
+};
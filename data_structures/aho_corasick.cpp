@@ -0,0 +1,165 @@
+/****************************************************************
+ * @file
+ * @brief Aho-Corasick tests
+****************************************************************/
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <random>
+#include <string>
+#include <tuple>
+#include <vector>
+#include "aho_corasick.h"
+
+int main(){
+    // region test 1
+    std::cout << "Test 1" << std::endl;
+    AhoCorasick ac1;
+    for(auto word : {"he", "she", "his", "hers"})
+        ac1.insert(word);
+    ac1.build();
+    std::vector<std::pair<int, std::size_t>> matches1;
+    ac1.feed("ushers", [&](int pattern, std::size_t end){matches1.emplace_back(pattern, end);});
+    std::cout << "Matches in ushers:";
+    for(auto [pattern, end] : matches1)
+        std::cout << " " << pattern << "@" << end;
+    std::cout << ", correct answer: 1@4 0@4 3@6" << std::endl;
+    std::cout << std::endl;
+    // endregion
+
+    // region test 2
+    std::cout << "Test 2" << std::endl;
+    AhoCorasick ac2;
+    ac2.insert("error: disk");
+    ac2.insert("timeout");
+    ac2.build();
+    int count2 = 0;
+    for(auto chunk : {"12:00 err", "or: disk full\n12:01 time", "out\n"})
+        ac2.feed(chunk, [&](int, std::size_t){count2++;});
+    std::cout << "Matches across chunks: " << count2 << ", correct answer: " << 2 << std::endl;
+    std::cout << std::endl;
+    // endregion
+
+    // region random test
+    std::mt19937 rng(42);
+    bool ok = true;
+    for(int dense_levels : {1, 2, 3, 8}){
+        for(int round = 0; round < 20; round++){
+            int letters = 2 + (int) (rng() % 4);
+            auto random_string = [&](int length){
+                std::string s(length, 'a');
+                for(auto &ch : s)
+                    ch = (char) ('a' + rng() % letters);
+                return s;
+            };
+            std::vector<std::string> words(1 + rng() % 30);
+            AhoCorasick ac(dense_levels);
+            std::vector<int> index(words.size());
+            for(std::size_t i = 0; i < words.size(); i++){
+                words[i] = random_string(1 + (int) (rng() % 6));
+                index[i] = ac.insert(words[i]);
+            }
+            ac.build();
+            std::string text = random_string(2000);
+            // text fed in random chunks
+            std::vector<std::pair<int, std::size_t>> found;
+            for(std::size_t pos = 0; pos < text.size();){
+                std::size_t len = std::min<std::size_t>(rng() % 50, text.size() - pos);
+                ac.feed(std::string_view(text).substr(pos, len),
+                        [&](int pattern, std::size_t end){found.emplace_back(pattern, end);});
+                pos += len;
+            }
+            std::vector<std::pair<int, std::size_t>> expected;
+            for(std::size_t i = 0; i < words.size(); i++){
+                if(std::find(index.begin(), index.begin() + i, index[i]) != index.begin() + i)
+                    continue;
+                for(std::size_t pos = text.find(words[i]); pos != std::string::npos; pos = text.find(words[i], pos + 1))
+                    expected.emplace_back(index[i], pos + words[i].size());
+            }
+            std::sort(found.begin(), found.end());
+            std::sort(expected.begin(), expected.end());
+            ok = ok && found == expected;
+        }
+    }
+    // chunks of at least 16 KiB are scanned in 4 lanes, long patterns cross the borders of the lanes,
+    // with one letter every pattern ends at every border
+    for(int dense_levels : {1, 3}){
+        for(int round = 0; round < 6; round++){
+            int letters = 1 + round % 3;
+            std::string text(1 << 17, 'a');
+            for(auto &ch : text)
+                ch = (char) ('a' + rng() % letters);
+            std::vector<std::string> words(1 + rng() % 10);
+            AhoCorasick ac(dense_levels);
+            std::vector<int> index(words.size());
+            for(std::size_t i = 0; i < words.size(); i++){
+                std::size_t length = 1 + rng() % 40;
+                words[i] = text.substr(rng() % (text.size() - length), length);
+                if(rng() % 2)  // a pattern that may not occur
+                    for(auto &ch : words[i])
+                        ch = (char) ('a' + rng() % letters);
+                index[i] = ac.insert(words[i]);
+            }
+            ac.build();
+            std::vector<std::pair<int, std::size_t>> found;
+            for(std::size_t pos = 0; pos < text.size();){
+                std::size_t len = std::min<std::size_t>((1 << 14) + rng() % (1 << 16), text.size() - pos);
+                ac.feed(std::string_view(text).substr(pos, len),
+                        [&](int pattern, std::size_t end){found.emplace_back(pattern, end);});
+                pos += len;
+            }
+            // one byte at a time never splits into lanes, its order is the stream order
+            std::vector<std::pair<int, std::size_t>> in_order;
+            ac.reset();
+            for(std::size_t pos = 0; pos < text.size(); pos++)
+                ac.feed(std::string_view(text).substr(pos, 1),
+                        [&](int pattern, std::size_t end){in_order.emplace_back(pattern, end);});
+            ok = ok && found == in_order;
+            std::vector<std::pair<int, std::size_t>> expected;
+            for(std::size_t i = 0; i < words.size(); i++){
+                if(std::find(index.begin(), index.begin() + i, index[i]) != index.begin() + i)
+                    continue;
+                for(std::size_t pos = text.find(words[i]); pos != std::string::npos; pos = text.find(words[i], pos + 1))
+                    expected.emplace_back(index[i], pos + words[i].size());
+            }
+            std::sort(found.begin(), found.end());
+            std::sort(expected.begin(), expected.end());
+            ok = ok && found == expected;
+        }
+    }
+    std::cout << "Random test " << (ok ? "passed" : "failed") << std::endl;
+    std::cout << std::endl;
+    // endregion
+
+    // region throughput
+    AhoCorasick ac;
+    for(int i = 0; i < 100000; i++){
+        std::string word(6 + rng() % 7, 'a');
+        for(auto &ch : word)
+            ch = (char) ('a' + rng() % 26);
+        ac.insert(word);
+    }
+    ac.build();
+    std::cout << "100000 patterns, " << ac.states() << " states, " << ac.memory() / (1 << 20) << " MiB" << std::endl;
+    // random letters keep the automaton deep, log lines are mostly bytes of no pattern
+    std::string letters(1 << 26, ' '), log;
+    for(auto &ch : letters)
+        if(rng() % 6)
+            ch = (char) ('a' + rng() % 26);
+    while(log.size() < letters.size())
+        log += "2024-05-17T12:" + std::to_string(rng() % 60) + " INFO [WORKER-" + std::to_string(rng() % 64)
+               + "] GET /API/V2/ITEMS/" + std::to_string(rng()) + " STATUS=200 user=" + letters.substr(rng() % 1000, 8)
+               + "\n";
+    for(auto [name, text] : {std::pair{"random letters", &letters}, {"log lines", &log}}){
+        std::size_t matches = 0;
+        auto start = std::chrono::steady_clock::now();
+        ac.reset();
+        ac.feed(*text, [&](int, std::size_t){matches++;});
+        double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        std::cout << name << ": " << text->size() / seconds / (1 << 30) << " GiB/s, " << matches << " matches"
+                  << std::endl;
+    }
+    // endregion
+    return 0;
+}
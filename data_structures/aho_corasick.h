@@ -0,0 +1,357 @@
+/****************************************************************
+ * @file
+ * @brief Aho-Corasick Automaton
+ * @details
+ * Finds all occurrences of many patterns in a text in one pass. The
+ * patterns are inserted into a trie like Trie, with children by byte, so any
+ * text can be scanned. build() adds to every node its failure link, the
+ * longest proper suffix of the node that is also a node, and the link to the
+ * next node on the failure chain that ends a pattern.
+ *
+ * Layout after build():
+ * 1) Bytes are mapped to classes, bytes of no pattern share class 0, so a
+ * row of transitions has one entry per distinct byte of the patterns.
+ * 2) Nodes are numbered in BFS order, so the nodes of the first dense_levels
+ * levels are a prefix. Each of them has a full row of transitions, the text
+ * usually stays near the root, where a byte is one lookup.
+ * 3) Deeper nodes keep their failure link and their children, sorted by
+ * class, next to each other, and fall back along failure links until a node
+ * has the child or is dense.
+ * 4) A transition holds the offset of the row of a dense target instead of
+ * its index, so a step is one load and an add. Its high bit is set if the
+ * target ends a pattern, so the scan loop only looks at outputs when there
+ * is one.
+ * 5) A step waits for the previous one, so a large chunk is split into 4
+ * lanes scanned in an interleaved loop. A lane starts from the root
+ * max_length - 1 bytes before its part, which finds every match that ends
+ * in its part, and the matches of lanes are reported in stream order.
+ *
+ * feed(chunk, on_match) keeps the state between calls, so a stream can be
+ * scanned in buffers of any size and matches across buffer boundaries are
+ * found. on_match(pattern, end) gets the index of the pattern and the
+ * position in the stream after its last byte.
+ *
+ * ### Complexity
+ * Insert : O(len)
+ * Build : O(m + d*a)
+ * Feed : O(len + matches)
+ * Space Complexity : O(m + d*a)
+ * Where m is the total length of the patterns, a is the number of byte
+ * classes and d is the number of dense nodes
+****************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+class AhoCorasick{
+    static constexpr std::uint32_t OUTPUT = 0x80000000u;  // bit of a transition to a node that ends a pattern
+    static constexpr std::uint32_t STATE = 0x7fffffffu;  // bits of the target of a transition
+    static constexpr int LANES = 4;  // parts of a chunk scanned at once
+    static constexpr std::size_t LANE_MIN = 1 << 12;  // smallest part of a lane
+
+    // region trie of the patterns, used until build()
+    struct TrieNode{
+        std::vector<std::pair<unsigned char, std::uint32_t>> children;  // byte and child, in insertion order
+        int pattern = -1;  // index of the pattern that ends here, -1 if none
+    };
+
+    std::vector<TrieNode> trie;  // trie[0] is the root
+    int pattern_count = 0;
+    std::size_t max_length = 0;  // length of the longest pattern
+    // endregion
+
+    // region automaton, nodes in BFS order, 0 is the root
+    struct SparseNode{
+        std::uint32_t edges;  // first edge, the edges of the next node follow
+        std::uint32_t fail;  // code of the failure link
+    };
+
+    struct Edge{
+        std::uint32_t cls;  // class of the byte
+        std::uint32_t target;  // tagged code of the child
+    };
+
+    int dense_levels;  // levels of the trie with full rows of transitions
+    bool built = false;
+    std::array<std::uint16_t, 256> classes{};  // class of a byte
+    std::uint32_t class_count = 1;
+    std::uint32_t dense_states = 0;  // nodes [0, dense_states) have full rows
+    std::uint32_t dense_limit = 0;  // codes below it are offsets of dense rows
+    std::vector<std::uint32_t> dense;  // dense[node * class_count + class] is a tagged code
+    std::vector<SparseNode> sparse;  // nodes from dense_states on, and one more for the end of the edges
+    std::vector<Edge> edges;
+    std::vector<int> pattern;  // index of the pattern that ends at a node, -1 if none
+    std::vector<std::uint32_t> output_link;  // next node on the failure chain that ends a pattern, 0 if none
+    // endregion
+
+    // region stream
+    std::uint32_t state = 0;  // code of the current node
+    std::size_t offset = 0;  // bytes fed so far
+    std::vector<std::pair<int, std::size_t>> pending[LANES];  // matches of lanes waiting for earlier lanes
+    // endregion
+
+    /**
+     * @brief Get the code of a node
+     * @details transitions hold codes: the offset of the row of a dense node,
+     * dense_limit + index among sparse nodes for the others
+     */
+    std::uint32_t code(std::uint32_t s) const{
+        return s < dense_states ? s * class_count : dense_limit + (s - dense_states);
+    }
+
+    /**
+     * @brief Get the node of a code
+     */
+    std::uint32_t node(std::uint32_t c) const{
+        return c < dense_limit ? c / class_count : c - dense_limit + dense_states;
+    }
+
+    /**
+     * @brief Transition of a node that is not dense
+     * @param c - code of the current node, c >= dense_limit
+     * @param cls - class of the byte
+     * @returns tagged code of the next node
+     */
+    std::uint32_t sparse_step(std::uint32_t c, std::uint32_t cls) const{
+        while(c >= dense_limit){
+            const SparseNode *s = &sparse[c - dense_limit];
+            for(std::uint32_t e = s->edges; e < s[1].edges && edges[e].cls <= cls; e++)
+                if(edges[e].cls == cls)
+                    return edges[e].target;
+            c = s->fail;
+        }
+        return dense[c + cls];
+    }
+
+    /**
+     * @brief Report all patterns that end at a node
+     */
+    template <typename Callback>
+    void report(std::uint32_t s, std::size_t end, Callback &on_match) const{
+        if(pattern[s] == -1)
+            s = output_link[s];
+        for(; s; s = output_link[s])
+            on_match(pattern[s], end);
+    }
+
+    /**
+     * @brief Scan a part of a chunk
+     * @param c - code of the node before the part
+     * @param text - chunk
+     * @param begin - first byte of the part
+     * @param end - end of the part
+     * @param on_match - callback of matches
+     * @returns code of the node after the part
+     */
+    template <typename Callback>
+    std::uint32_t scan(std::uint32_t c, const unsigned char *text, std::size_t begin, std::size_t end,
+                       Callback &on_match) const{
+        const std::uint32_t *table = dense.data(), limit = dense_limit;
+        const std::uint16_t *cls = classes.data();
+        for(std::size_t i = begin; i < end; i++){
+            std::uint32_t next = c < limit ? table[c + cls[text[i]]] : sparse_step(c, cls[text[i]]);
+            c = next & STATE;
+            if(next & OUTPUT)
+                report(node(c), offset + i + 1, on_match);
+        }
+        return c;
+    }
+
+public:
+    /**
+     * @brief Constructor
+     * @param dense_levels - levels of the trie with full rows of transitions, at least 1
+     */
+    explicit AhoCorasick(int dense_levels = 3) : dense_levels(std::max(dense_levels, 1)){
+        trie.emplace_back();
+    }
+
+    /**
+     * @brief Inserts a pattern
+     * @param str - pattern, not empty
+     * @returns index of the pattern, the same index for a repeated pattern
+     */
+    int insert(std::string_view str){
+        if(built)
+            throw std::runtime_error("Automaton is already built");
+        if(str.empty())
+            throw std::runtime_error("Pattern is empty");
+        std::uint32_t curr = 0;
+        for(unsigned char c : str){
+            std::uint32_t next = 0;
+            for(auto &[byte, child] : trie[curr].children)
+                if(byte == c)
+                    next = child;
+            if(next == 0){
+                if(trie.size() > STATE)
+                    throw std::runtime_error("Too many nodes");
+                next = (std::uint32_t) trie.size();
+                trie[curr].children.emplace_back(c, next);
+                trie.emplace_back();
+            }
+            curr = next;
+        }
+        max_length = std::max(max_length, str.size());
+        if(trie[curr].pattern == -1)
+            trie[curr].pattern = pattern_count++;
+        return trie[curr].pattern;
+    }
+
+    /**
+     * @brief Builds the automaton, no patterns can be inserted after it
+     */
+    void build(){
+        if(built)
+            throw std::runtime_error("Automaton is already built");
+        built = true;
+        // classes of bytes in byte order, 0 for bytes of no pattern
+        std::array<bool, 256> used{};
+        for(auto &node : trie)
+            for(auto &[byte, child] : node.children)
+                used[byte] = true;
+        for(int b = 0; b < 256; b++)
+            if(used[b])
+                classes[b] = (std::uint16_t) class_count++;
+
+        // BFS order, levels are contiguous
+        std::uint32_t n = trie.size();
+        std::vector<std::uint32_t> order = {0}, id(n), depth = {0};
+        for(std::size_t i = 0; i < order.size(); i++){
+            auto &children = trie[order[i]].children;
+            std::sort(children.begin(), children.end());
+            for(auto &[byte, child] : children){
+                id[child] = (std::uint32_t) order.size();
+                order.push_back(child);
+                depth.push_back(depth[i] + 1);
+            }
+        }
+        while(dense_states < n && depth[dense_states] < (std::uint32_t) dense_levels)
+            dense_states++;
+        if((std::uint64_t) dense_states * class_count + (n - dense_states) > STATE)
+            throw std::runtime_error("Too many nodes");
+        dense_limit = dense_states * class_count;
+
+        pattern.assign(n, -1);
+        output_link.assign(n, 0);
+        for(std::uint32_t s = 0; s < n; s++)
+            pattern[s] = trie[order[s]].pattern;
+        auto tagged = [&](std::uint32_t s){
+            return pattern[s] != -1 || output_link[s] ? code(s) | OUTPUT : code(s);
+        };
+        dense.assign((std::size_t) dense_limit, 0);
+        sparse.assign(n - dense_states + 1, {0, 0});
+
+        // the failure link of a node is found from its parent, which is earlier in BFS order
+        std::vector<std::uint32_t> fail(n, 0);
+        for(std::uint32_t s = 0; s < n; s++){
+            if(s >= dense_states)
+                sparse[s - dense_states] = {(std::uint32_t) edges.size(), code(fail[s])};
+            for(auto &[byte, child] : trie[order[s]].children){
+                std::uint32_t t = id[child], cls = classes[byte];
+                fail[t] = s == 0 ? 0 : node(sparse_step(code(fail[s]), cls) & STATE);
+                output_link[t] = pattern[fail[t]] != -1 ? fail[t] : output_link[fail[t]];
+                if(s >= dense_states)
+                    edges.push_back({cls, tagged(t)});
+            }
+            if(s < dense_states){
+                std::uint32_t *row = &dense[(std::size_t) s * class_count];
+                for(std::uint32_t cls = 0; cls < class_count; cls++)
+                    row[cls] = s == 0 ? 0 : sparse_step(code(fail[s]), cls);
+                for(auto &[byte, child] : trie[order[s]].children)
+                    row[classes[byte]] = tagged(id[child]);
+            }
+        }
+        sparse.back() = {(std::uint32_t) edges.size(), 0};
+        trie.clear();
+        trie.shrink_to_fit();
+    }
+
+    /**
+     * @brief Scans the next chunk of the stream
+     * @param chunk - next bytes of the stream
+     * @param on_match - called as on_match(pattern, end) for every match, end is the position after it
+     */
+    template <typename Callback>
+    void feed(std::string_view chunk, Callback &&on_match){
+        if(!built)
+            throw std::runtime_error("Automaton is not built");
+        const unsigned char *text = reinterpret_cast<const unsigned char *>(chunk.data());
+        std::size_t n = chunk.size(), part = n / LANES;
+        if(part < std::max(LANE_MIN, max_length)){
+            state = scan(state, text, 0, n, on_match);
+            offset += n;
+            return;
+        }
+        // lanes after the first start at the root, a match ending in a part starts at most max_length - 1 before it
+        std::uint32_t codes[LANES];
+        codes[0] = state;
+        auto ignore = [](int, std::size_t){};
+        for(int k = 1; k < LANES; k++)
+            codes[k] = scan(0, text, k * part - (max_length - 1), k * part, ignore);
+        // members are read once and lanes are kept in registers, the stores of matches could alias them
+        const std::uint32_t *table = dense.data(), limit = dense_limit;
+        const std::uint16_t *cls = classes.data();
+        auto lane_step = [&](int k, std::uint32_t &c, std::size_t pos){
+            std::uint32_t next = c < limit ? table[c + cls[text[pos]]] : sparse_step(c, cls[text[pos]]);
+            c = next & STATE;
+            if(next & OUTPUT){
+                auto push = [&](int p, std::size_t end){pending[k].emplace_back(p, end);};
+                report(node(c), offset + pos + 1, push);
+            }
+        };
+        std::uint32_t c0 = codes[0], c1 = codes[1], c2 = codes[2], c3 = codes[3];
+        static_assert(LANES == 4, "The loop is unrolled for 4 lanes");
+        for(std::size_t i = 0; i < part; i++){
+            lane_step(0, c0, i);
+            lane_step(1, c1, part + i);
+            lane_step(2, c2, 2 * part + i);
+            lane_step(3, c3, 3 * part + i);
+        }
+        for(auto &matches : pending){
+            for(auto [p, end] : matches)
+                on_match(p, end);
+            matches.clear();
+        }
+        state = scan(c3, text, LANES * part, n, on_match);
+        offset += n;
+    }
+
+    /**
+     * @brief Starts a new stream
+     */
+    void reset(){
+        state = 0;
+        offset = 0;
+    }
+
+    /**
+     * @brief Get the number of distinct patterns
+     */
+    int patterns() const{
+        return pattern_count;
+    }
+
+    /**
+     * @brief Get the number of nodes
+     */
+    std::size_t states() const{
+        return built ? pattern.size() : trie.size();
+    }
+
+    /**
+     * @brief Get the memory used by the built automaton in bytes
+     */
+    std::size_t memory() const{
+        return dense.size() * sizeof(std::uint32_t) + sparse.size() * sizeof(SparseNode)
+               + edges.size() * sizeof(Edge) + pattern.size() * sizeof(int)
+               + output_link.size() * sizeof(std::uint32_t) + sizeof(classes);
+    }
+};
@@ -0,0 +1,67 @@
+/****************************************************************
+ * @file
+ * @brief Block Sparse Table tests
+****************************************************************/
+
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "block_sparse_table.h"
+#include "sparse_table.h"
+
+int main(){
+    // region test 1
+    std::cout << "Test 1" << std::endl;
+    std::vector<int> arr1(100);
+    for(int i = 0; i < 100; i++)
+        arr1[i] = (i * 37) % 101;
+    BlockSparseTable<int> table1(arr1, [](int a, int b){return std::min(a, b);});
+    std::cout << table1.query(0, 99) << ", correct answer: " << 0 << std::endl;
+    std::cout << table1.query(1, 10) << ", correct answer: " << 10 << std::endl;
+    std::cout << table1.query(30, 70) << ", correct answer: " << 2 << std::endl;
+    std::cout << std::endl;
+    // endregion
+
+    // region test 2
+    std::cout << "Test 2" << std::endl;
+    std::vector<double> arr2 = {1.5, 9.5, 2.5, 8.5, 3.5};
+    BlockSparseTable<double> table2(arr2, [](double a, double b){return std::max(a, b);});
+    std::cout << table2.query(2, 4) << ", correct answer: " << 8.5 << std::endl;
+    std::cout << table2.query(0, 4) << ", correct answer: " << 9.5 << std::endl;
+    std::cout << std::endl;
+    // endregion
+
+    // region random test
+    std::mt19937 rng(42);
+    bool ok = true;
+    for(int n : {1, 2, 31, 32, 33, 64, 100, 1000, 5000}){
+        std::vector<int> arr(n);
+        for(auto &x : arr)
+            x = (int) (rng() % 50);
+        SparseTable<int> expected(arr, [](int a, int b){return std::min(a, b);});
+        BlockSparseTable<int> min_table(arr, [](int a, int b){return std::min(a, b);});
+        BlockSparseTable<int> max_table(arr, [](int a, int b){return std::max(a, b);});
+        for(int step = 0; step < 2000; step++){
+            int l = (int) (rng() % n), r = (int) (rng() % n);
+            if(l > r)
+                std::swap(l, r);
+            ok = ok && min_table.query(l, r) == expected.query(l, r)
+                 && max_table.query(l, r) == *std::max_element(arr.begin() + l, arr.begin() + r + 1);
+        }
+    }
+    std::cout << "Random test " << (ok ? "passed" : "failed") << std::endl;
+    std::cout << std::endl;
+    // endregion
+
+    // region memory
+    std::vector<int> arr(1 << 20);
+    for(auto &x : arr)
+        x = (int) rng();
+    SparseTable<int> sparse(arr, [](int a, int b){return std::min(a, b);});
+    BlockSparseTable<int> block(arr, [](int a, int b){return std::min(a, b);});
+    std::cout << "Memory of " << arr.size() << " ints: SparseTable " << sparse.memory() / (1 << 20)
+              << " MiB, BlockSparseTable " << block.memory() / (1 << 20) << " MiB" << std::endl;
+    // endregion
+    return 0;
+}
@@ -0,0 +1,125 @@
+/****************************************************************
+ * @file
+ * @brief Block Sparse Table Data Structure
+ * @details
+ * Range minimum or maximum queries in O(1) with O(n) memory (Fischer-Heun
+ * block decomposition). The array is split into blocks of 32 elements:
+ * 1) A sparse table over the results of the blocks answers the whole blocks
+ * of a query, it has n/32 * log(n/32) values.
+ * 2) Inside a block, masks[i] marks the positions j <= i of the block such
+ * that a[j] is the result of [j, i], the stack of a monotonic stack after i.
+ * The result of [l, r] inside a block is the lowest marked position >= l in
+ * masks[r], one countr_zero.
+ *
+ * A query is at most two in-block lookups and one sparse table query. The
+ * structure takes sizeof(T) + 4 bytes per element plus the small table,
+ * SparseTable takes sizeof(T) * (log n + 1). func must return one of its
+ * arguments, e.g. min or max, so gcd or bitwise and are not supported.
+ *
+ * ### Complexity
+ *
+ * Build : O(n)
+ * Range Query : O(1)
+ * Space Complexity : O(n)
+****************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+template <typename T>
+class BlockSparseTable{
+    static constexpr int BLOCK = 32;  // elements in a block, bits in a mask
+
+    std::vector<T> values;  // copy of the input array
+    std::vector<std::uint32_t> masks;  // masks[i] bit k: a[block start + k] is the result of [k, i] in the block
+    std::vector<T> table;  // sparse table over blocks, level-major: table[j * blocks + i] is blocks [i, i + 2^j)
+    int n;  // size of input array
+    int blocks;  // number of blocks
+    T (*func)(T, T);  // function to use for range queries
+
+    /**
+     * @brief Check if a is at least as good as b
+     */
+    bool keeps(const T &a, const T &b) const{
+        return func(a, b) == a;
+    }
+
+    /**
+     * @brief Range Query inside one block
+     * @param l - left border of range
+     * @param r - right border of range, in the block of l
+     * @return result of range query
+     */
+    T in_block(int l, int r) const{
+        std::uint32_t mask = masks[r] & (~std::uint32_t(0) << (l % BLOCK));
+        return values[l - l % BLOCK + std::countr_zero(mask)];
+    }
+
+    /**
+     * @brief Range Query over whole blocks
+     * @param l - first block
+     * @param r - last block, inclusive
+     * @return result of range query
+     */
+    T over_blocks(int l, int r) const{
+        int j = std::bit_width((unsigned) (r - l + 1)) - 1;
+        return func(table[(std::size_t) j * blocks + l], table[(std::size_t) j * blocks + r - (1 << j) + 1]);
+    }
+
+public:
+    /**
+     * @brief Constructor
+     * @param arr - input array
+     * @param f - function to use for range queries
+     */
+    BlockSparseTable(const std::vector<T> &arr, T (*f)(T, T)) : values(arr), masks(arr.size()){
+        n = arr.size();
+        func = f;
+        blocks = (n + BLOCK - 1) / BLOCK;
+        for(int start = 0; start < n; start += BLOCK){
+            std::uint32_t stack = 0;  // positions of the monotonic stack as bits, the top is the highest bit
+            for(int k = 0; k < BLOCK && start + k < n; k++){
+                while(stack && !keeps(values[start + BLOCK - 1 - std::countl_zero(stack)], values[start + k]))
+                    stack &= ~(std::uint32_t(1) << (BLOCK - 1 - std::countl_zero(stack)));
+                stack |= std::uint32_t(1) << k;
+                masks[start + k] = stack;
+            }
+        }
+        int levels = blocks ? std::bit_width((unsigned) blocks) : 0;
+        table.resize((std::size_t) levels * blocks);
+        for(int i = 0; i < blocks; i++)
+            table[i] = in_block(i * BLOCK, std::min(n, (i + 1) * BLOCK) - 1);
+        for(int j = 1; j < levels; j++)
+            for(int i = 0; i + (1 << j) <= blocks; i++)
+                table[(std::size_t) j * blocks + i] = func(table[(std::size_t) (j - 1) * blocks + i],
+                                                           table[(std::size_t) (j - 1) * blocks + i + (1 << (j - 1))]);
+    }
+
+    /**
+     * @brief Range Query
+     * @param l - left border of range
+     * @param r - right border of range
+     * @return result of range query
+     */
+    T query(int l, int r) const{
+        int left_block = l / BLOCK, right_block = r / BLOCK;
+        if(left_block == right_block)
+            return in_block(l, r);
+        T res = func(in_block(l, left_block * BLOCK + BLOCK - 1), in_block(right_block * BLOCK, r));
+        if(left_block + 1 < right_block)
+            res = func(res, over_blocks(left_block + 1, right_block - 1));
+        return res;
+    }
+
+    /**
+     * @brief Get the memory used by the table in bytes
+     */
+    std::size_t memory() const{
+        return values.size() * sizeof(T) + masks.size() * sizeof(std::uint32_t) + table.size() * sizeof(T);
+    }
+};
@@ -0,0 +1,151 @@
+/****************************************************************
+ * @file
+ * @brief Circular Queue Data Structure
+ * @details
+ * Circular Queue is a data structure, that allows adding and removing elements
+ * in a FIFO (First In First Out) order
+ * It allows to get elements by circular order
+ *
+ * Realization using linked list
+ *
+ * ### Complexity
+ *
+ * Access : O(1)
+ * Search : O(n)
+ * Insert : O(1)
+ * Delete : O(1)
+ * Space Complexity : O(n)
+****************************************************************/
+
+#pragma once
+
+#include <iostream>
+#include <stdexcept>
+
+template <typename T>
+struct CircQNode{
+    T data;
+    CircQNode<T> *next;
+};
+template <typename T>
+class CircularQueue{
+    CircQNode<T> *front = nullptr;
+    CircQNode<T> *rear = nullptr;
+
+    /**
+     * @brief Creates first node
+     * @param val - value to add
+     */
+     void create_node(T val){
+        auto *nd = new CircQNode<T>;
+        nd->data = val;
+        nd->next = nullptr;
+        front = nd;
+        rear = nd;
+    }
+
+public:
+    /**
+     * @brief Constructor
+     */
+    CircularQueue() = default;
+
+    /**
+     * @brief Check if queue is empty
+     * @returns true if queue is empty
+     */
+    bool is_empty(){
+        return front == nullptr || rear == nullptr;
+    }
+
+    /**
+     * @brief Add element to the end of the queue
+     */
+    void add(T val){
+        if(front == nullptr || rear == nullptr)
+            create_node(val);
+        else{
+            auto *nd = new CircQNode<T>;
+            nd->data = val;
+            rear->next = nd;
+            nd->next = front;
+            rear = nd;
+        }
+    }
+
+    /**
+     * @brief Get and remove element from the front of the queue
+     * @returns value of the element
+     */
+    T remove(){
+        if(front == nullptr || rear == nullptr)
+            throw std::runtime_error("Queue is empty");
+        else{
+            T val = front->data;
+            if(front == rear){
+                delete front;
+                front = nullptr;
+                rear = nullptr;
+            }else{
+                CircQNode<T> *temp = front;
+                front = front->next;
+                rear->next = front;
+                delete temp;
+            }
+            return val;
+        }
+    }
+
+    /**
+     * @brief Get and move to the end element from the front of the queue
+     * @returns value of the element
+     */
+     T move(){
+        if(front == nullptr || rear == nullptr)
+            throw std::runtime_error("Queue is empty");
+        else{
+            T val = front->data;
+            if(front != rear){
+                CircQNode<T> *temp = front;
+                front = front->next;
+                rear->next = temp;
+                rear = temp;
+                rear->next = front;
+            }
+            return val;
+        }
+     }
+
+    /**
+     * @brief Traverse the queue
+     */
+    void traverse(){
+        if(front == nullptr || rear == nullptr)
+            throw std::runtime_error("Queue is empty");
+        else{
+            CircQNode<T> *temp = front;
+            while(temp->next != front){
+                std::cout << temp->data << " ";
+                temp = temp->next;
+            }
+            std::cout << temp->data << std::endl;
+        }
+    }
+
+    /**
+     * @brief Destructor
+     */
+    ~CircularQueue(){
+        if(front == nullptr || rear == nullptr)
+            return;
+        else{
+            CircQNode<T> *temp = front;
+            while(temp->next != front){
+                CircQNode<T> *temp2 = temp;
+                temp = temp->next;
+                delete temp2;
+            }
+            delete temp;
+        }
+    }
+};
@@ -0,0 +1,113 @@
+/****************************************************************
+ * @file
+ * @brief DAWG tests
+****************************************************************/
+
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "dawg.h"
+#include "trie.h"
+
+int main(){
+    // region test 1
+    std::cout << "Test 1" << std::endl;
+    std::vector<std::string> words1 = {"hello", "world", "hello", "a", "b", "abc", "abcc", "abcd"};
+    std::sort(words1.begin(), words1.end());
+    Dawg dawg1;
+    for(auto &word : words1)
+        dawg1.insert(word);
+    dawg1.finish();
+    std::cout << "Search for hello: " << dawg1.search("hello") << ", correct answer: 1" << std::endl;
+    std::cout << "Search for unknown: " << dawg1.search("unknown") << ", correct answer: 0" << std::endl;
+    std::cout << "Count of hello: " << dawg1.count("hello") << ", correct answer: 2" << std::endl;
+    dawg1.remove("abc");
+    std::cout << "Search for abc: " << dawg1.search("abc") << ", correct answer: 0" << std::endl;
+    std::cout << "Sorted strings:";
+    for(const auto &s : dawg1.sort())
+        std::cout << " " << s;
+    std::cout << ", correct answer: a abcc abcd b hello hello world" << std::endl;
+    std::cout << std::endl;
+    // endregion
+
+    // region test 2
+    std::cout << "Test 2" << std::endl;
+    Trie trie2;
+    Dawg dawg2;
+    for(auto word : {"tap", "taps", "top", "tops"}){
+        trie2.insert(word);
+        dawg2.insert(word);
+    }
+    dawg2.finish();
+    std::cout << "Nodes: trie " << trie2.nodes() << ", dawg " << dawg2.nodes() << ", correct answer: 8 5" << std::endl;
+    // the path of tops is minimized when zap comes, its 3 replaced nodes are reused by zap
+    Dawg dawg3;
+    for(auto word : {"tap", "taps", "top", "tops", "zap"})
+        dawg3.insert(word);
+    std::cout << "Nodes before finish: " << dawg3.nodes() << ", correct answer: 8" << std::endl;
+    std::cout << std::endl;
+    // endregion
+
+    // region random test
+    std::mt19937 rng(42);
+    bool ok = true;
+    for(int round = 0; round < 200; round++){
+        int letters = 1 + (int) (rng() % 4);
+        auto random_string = [&](){
+            std::string s(rng() % 7, 'a');
+            for(auto &ch : s)
+                ch = (char) ('a' + rng() % letters);
+            return s;
+        };
+        std::vector<std::string> words(rng() % 60);
+        for(auto &word : words)
+            word = random_string();
+        std::sort(words.begin(), words.end());
+        Trie trie;
+        Dawg dawg;
+        for(auto &word : words){
+            trie.insert(word);
+            dawg.insert(word);
+        }
+        std::size_t live = dawg.nodes();
+        dawg.finish();
+        ok = ok && live <= trie.nodes() && dawg.nodes() <= live;
+        for(int op = 0; op < 100; op++){
+            std::string word = random_string();
+            if(rng() % 3 == 0 && trie.search(word)){
+                trie.remove(word);
+                dawg.remove(word);
+            }
+            ok = ok && trie.search(word) == dawg.search(word);
+        }
+        ok = ok && trie.sort() == dawg.sort();
+    }
+    std::cout << "Random test " << (ok ? "passed" : "failed") << std::endl;
+    std::cout << std::endl;
+    // endregion
+
+    // region memory
+    // inflected forms of stems share their endings, which the DAWG stores once
+    std::vector<std::string> dictionary;
+    for(int i = 0; i < 50000; i++){
+        std::string stem(3 + rng() % 6, 'a');
+        for(auto &ch : stem)
+            ch = (char) ('a' + rng() % 26);
+        for(auto suffix : {"", "s", "ed", "er", "ers", "ing", "ings", "ness"})
+            dictionary.push_back(stem + suffix);
+    }
+    std::sort(dictionary.begin(), dictionary.end());
+    Trie trie;
+    Dawg dawg;
+    for(auto &word : dictionary){
+        trie.insert(word);
+        dawg.insert(word);
+    }
+    dawg.finish();
+    std::cout << dictionary.size() << " words: trie " << trie.nodes() << " nodes, " << trie.memory() / (1 << 20)
+              << " MiB, dawg " << dawg.nodes() << " nodes, " << dawg.memory() / (1 << 20) << " MiB" << std::endl;
+    // endregion
+    return 0;
+}
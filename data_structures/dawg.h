@@ -0,0 +1,307 @@
+/****************************************************************
+ * @file
+ * @brief DAWG (Minimal Acyclic Automaton) Data Structure
+ * @details
+ * A directed acyclic word graph stores a set of strings like Trie, but
+ * nodes with the same set of suffixes are merged, so common endings such as
+ * "-ing" or "-ness" are stored once. It is built incrementally from sorted
+ * input (Daciuk et al.): when a word is inserted, the part of the previous
+ * word after their common prefix can no longer change, so its nodes are
+ * replaced by equal nodes from a register or added to it. The graph stays
+ * minimal after every word, and a replaced node is reused by the next words.
+ *
+ * A merged node belongs to many words, so counts can not be kept in nodes.
+ * Words are numbered in sorted order, and every edge keeps how many words
+ * are skipped by taking it: the sum along the path of a word is its number,
+ * which indexes an array of counts.
+ *
+ * After finish() the nodes are stored in flat arrays: the edges of a node
+ * are a contiguous range sorted by byte.
+ *
+ * ### Complexity
+ * Insert : O(len) amortized, words in sorted order
+ * Search : O(len*a)
+ * Remove : O(len*a)
+ * Sort : O(n)
+ * Where len is the length of the string, n is the total length of the
+ * strings and a is the number of children of a node
+ * Space Complexity : O(nodes + edges), at most as many nodes as Trie
+****************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+class Dawg{
+    // region construction
+    struct BuildNode{
+        bool final = false;
+        std::vector<std::pair<unsigned char, std::uint32_t>> edges;  // sorted by byte, the last one can change
+    };
+
+    struct Unchecked{
+        std::uint32_t parent;
+        std::uint32_t child;  // target of the last edge of parent
+    };
+
+    std::vector<BuildNode> pool;  // pool[0] is the root
+    std::vector<std::uint32_t> free_nodes;  // replaced nodes in the pool, reused by insert
+    std::vector<Unchecked> unchecked;  // path of the previous word that is not minimized yet
+    std::unordered_map<std::string, std::uint32_t> registry;  // signature of a minimized node to the node
+    std::string previous;  // last inserted word
+    bool finished = false;
+    // endregion
+
+    // region graph after finish(), node 0 is the root
+    std::vector<std::uint32_t> first_edge;  // edges of node v are [first_edge[v], first_edge[v + 1])
+    std::vector<unsigned char> label;  // byte of an edge
+    std::vector<std::uint32_t> target;  // node of an edge
+    std::vector<std::uint32_t> skip;  // words before the ones of an edge among the words of its node
+    std::vector<bool> final;  // a word ends at a node
+    std::vector<int> counts;  // counts[i] is the count of the i-th word in sorted order
+    // endregion
+
+    /**
+     * @brief Signature of a node, equal for nodes with the same suffixes once their children are minimized
+     */
+    std::string signature(std::uint32_t node) const{
+        std::string key(1, pool[node].final ? '1' : '0');
+        for(auto &[c, child] : pool[node].edges){
+            key += (char) c;
+            key.append(reinterpret_cast<const char *>(&child), sizeof(child));
+        }
+        return key;
+    }
+
+    /**
+     * @brief Minimize the path of the previous word below a depth
+     * @param depth - length of the prefix that is kept
+     */
+    void minimize(std::size_t depth){
+        while(unchecked.size() > depth){
+            auto [parent, child] = unchecked.back();
+            unchecked.pop_back();
+            auto [it, added] = registry.try_emplace(signature(child), child);
+            if(!added){
+                // only parent points to child, its children are minimized and stay
+                pool[parent].edges.back().second = it->second;
+                pool[child].final = false;
+                pool[child].edges.clear();
+                free_nodes.push_back(child);
+            }
+        }
+    }
+
+    /**
+     * @brief Copy the reachable nodes to flat arrays in preorder
+     * @param node - node in the pool
+     * @param id - new index of every pool node, UINT32_MAX if not visited
+     * @returns new index of the node
+     */
+    std::uint32_t compact(std::uint32_t node, std::vector<std::uint32_t> &id){
+        if(id[node] != UINT32_MAX)
+            return id[node];
+        std::uint32_t v = id[node] = (std::uint32_t) final.size();
+        final.push_back(pool[node].final);
+        first_edge.push_back((std::uint32_t) label.size());
+        for(auto &[c, child] : pool[node].edges){
+            label.push_back(c);
+            target.push_back(0);
+        }
+        // children are numbered after the edges of this node are reserved
+        for(std::size_t i = 0; i < pool[node].edges.size(); i++){
+            std::uint32_t t = compact(pool[node].edges[i].second, id);
+            target[first_edge[v] + i] = t;
+        }
+        return v;
+    }
+
+    /**
+     * @brief Count the words of every node and fill the skips of the edges
+     * @param v - node
+     * @param words - number of words of every node, UINT32_MAX if not counted
+     * @returns number of words of v
+     */
+    std::uint32_t annotate(std::uint32_t v, std::vector<std::uint32_t> &words){
+        if(words[v] != UINT32_MAX)
+            return words[v];
+        std::uint32_t total = final[v] ? 1 : 0;
+        for(std::uint32_t e = first_edge[v]; e < first_edge[v + 1]; e++){
+            skip[e] = total;
+            total += annotate(target[e], words);
+        }
+        return words[v] = total;
+    }
+
+    /**
+     * @brief Find the number of a word
+     * @returns index of the word in counts, -1 if it is not in the graph
+     */
+    long long find(const std::string &str) const{
+        if(!finished)
+            throw std::runtime_error("Dawg is not finished");
+        std::uint32_t v = 0;
+        long long index = 0;
+        for(unsigned char c : str){
+            std::uint32_t e = first_edge[v], end = first_edge[v + 1];
+            while(e < end && label[e] < c)
+                e++;
+            if(e == end || label[e] != c)
+                return -1;
+            index += skip[e];
+            v = target[e];
+        }
+        return final[v] ? index : -1;
+    }
+
+    /**
+     * @brief DFS for sorting
+     * @param v - current node
+     * @param str - current string
+     * @param index - number of the next word
+     * @param sorted - sorted array
+     */
+    void sortUtil(std::uint32_t v, std::string &str, std::size_t &index, std::vector<std::string> &sorted) const{
+        if(final[v]){
+            for(int count = counts[index++]; count > 0; count--)
+                sorted.push_back(str);
+        }
+        for(std::uint32_t e = first_edge[v]; e < first_edge[v + 1]; e++){
+            str.push_back((char) label[e]);
+            sortUtil(target[e], str, index, sorted);
+            str.pop_back();
+        }
+    }
+
+public:
+    /**
+     * @brief Constructor
+     */
+    Dawg(){
+        pool.emplace_back();
+    }
+
+    /**
+     * @brief Inserts a string, strings must come in sorted order
+     * @param str - string to insert, equal to or after the previous one
+     */
+    void insert(const std::string &str){
+        if(finished)
+            throw std::runtime_error("Dawg is finished");
+        if(!counts.empty() && str < previous)
+            throw std::runtime_error("Strings must be inserted in sorted order");
+        if(!counts.empty() && str == previous){
+            counts.back()++;
+            return;
+        }
+        std::size_t common = 0;
+        while(common < str.size() && common < previous.size() && str[common] == previous[common])
+            common++;
+        minimize(common);
+        std::uint32_t node = unchecked.empty() ? 0 : unchecked.back().child;
+        for(std::size_t i = common; i < str.size(); i++){
+            std::uint32_t child;
+            if(free_nodes.empty()){
+                child = (std::uint32_t) pool.size();
+                pool.emplace_back();
+            }else{
+                child = free_nodes.back();
+                free_nodes.pop_back();
+            }
+            pool[node].edges.emplace_back((unsigned char) str[i], child);
+            unchecked.push_back({node, child});
+            node = child;
+        }
+        pool[node].final = true;
+        counts.push_back(1);
+        previous = str;
+    }
+
+    /**
+     * @brief Minimizes the rest of the graph and stores it in flat arrays, no strings can be inserted after it
+     */
+    void finish(){
+        if(finished)
+            return;
+        minimize(0);
+        std::vector<std::uint32_t> id(pool.size(), UINT32_MAX);
+        compact(0, id);
+        first_edge.push_back((std::uint32_t) label.size());
+        skip.assign(label.size(), 0);
+        std::vector<std::uint32_t> words(final.size(), UINT32_MAX);
+        annotate(0, words);
+        finished = true;
+        pool.clear();
+        pool.shrink_to_fit();
+        free_nodes.clear();
+        free_nodes.shrink_to_fit();
+        registry.clear();
+        unchecked.clear();
+        previous.clear();
+    }
+
+    /**
+     * @brief Searches for a string
+     * @param str - string to search
+     * @returns true if the string is found
+     */
+    bool search(const std::string &str) const{
+        long long index = find(str);
+        return index != -1 && counts[index] > 0;
+    }
+
+    /**
+     * @brief Get the number of times a string was inserted and not removed
+     */
+    int count(const std::string &str) const{
+        long long index = find(str);
+        return index == -1 ? 0 : counts[index];
+    }
+
+    /**
+     * @brief Removes a string
+     * @param str - string to remove
+     */
+    void remove(const std::string &str){
+        long long index = find(str);
+        if(index == -1 || counts[index] == 0)
+            throw std::runtime_error("String not found");
+        counts[index]--;
+    }
+
+    /**
+     * @brief Get sorted strings
+     * @returns vector with sorted strings
+     */
+    std::vector<std::string> sort() const{
+        if(!finished)
+            throw std::runtime_error("Dawg is not finished");
+        std::vector<std::string> sorted;
+        std::string str;
+        std::size_t index = 0;
+        sortUtil(0, str, index, sorted);
+        return sorted;
+    }
+
+    /**
+     * @brief Get the number of nodes, before finish() the ones of the strings so far
+     */
+    std::size_t nodes() const{
+        return finished ? final.size() : pool.size() - free_nodes.size();
+    }
+
+    /**
+     * @brief Get the memory used by the finished graph in bytes
+     */
+    std::size_t memory() const{
+        return first_edge.size() * sizeof(std::uint32_t) + label.size()
+               + (target.size() + skip.size()) * sizeof(std::uint32_t) + final.size() / 8
+               + counts.size() * sizeof(int);
+    }
+};
@@ -0,0 +1,102 @@
+/****************************************************************
+ * @file
+ * @brief Disjoint Set Union Data Structure
+ * @details
+ * A disjoint set data structure (also called union find or merge find set)
+ * is a data structure that tracks a set of elements partitioned into a number
+ * of disjoint (non-overlapping) subsets.
+ * Some situations where disjoint sets can be used are-
+ * to find connected components of a graph, kruskal's algorithm for finding
+ *
+ * Operations:
+ * 1) Make Set: Creates n disjoint sets with single item in each
+ * 2) Union Sets: Joins two sets together to one set
+ * 3) Find Set: Finds the set that a particular element is an element of
+****************************************************************/
+
+#pragma once
+
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "snapshot_format.h"
+
+template <typename T>
+class DSU{
+    std::vector<T> parent;  // parent[i] stores the parent of i
+    std::vector<T> rank;  // rank[i] stores the rank of the tree rooted at i
+    int n;  // number of elements in the set
+
+public:
+    /**
+     * @brief Constructor
+     * @param size - number of elements in the set
+     */
+    explicit DSU(T size){
+        n = size;
+        parent.resize(n);
+        rank.resize(n);
+        for(T i = 0; i < n; i++){
+            parent[i] = i;
+            rank[i] = 0;
+        }
+    }
+
+    /**
+     * @brief Find the set that i is an element of
+     * @param i - element to find the set of
+     * @returns representative of the set that i is an element of
+     */
+    T find_set(T i){
+        if(parent[i] != i){
+            parent[i] = find_set(parent[i]);
+        }
+        return parent[i];
+    }
+
+    /**
+     * @brief Union two sets
+     * @param i - first set
+     * @param j - second set
+     */
+    void union_sets(T i, T j){
+        T x = find_set(i);
+        T y = find_set(j);
+        if(x == y){
+            return;
+        }
+        if(rank[x] < rank[y]){
+            parent[x] = y;
+        }else if(rank[y] < rank[x]){
+            parent[y] = x;
+        }else{
+            parent[x] = y;
+            rank[y]++;
+        }
+    }
+
+    /**
+     * @brief Check if two elements are in the same set
+     */
+    bool same_set(T i, T j){
+        return find_set(i) == find_set(j);
+    }
+
+    /**
+     * @brief Save the sets to a snapshot file, DSUView maps it back
+     * @details the representative of every element is saved, so the view needs no find
+     * @param path - file to write, replaced if it exists
+     */
+    void save(const std::string &path) const{
+        static_assert(std::is_trivially_copyable_v<T>, "Snapshots need a trivially copyable T");
+        std::vector<T> representative(n);
+        for(T i = 0; i < n; i++){
+            T root = i;
+            while(parent[root] != root)
+                root = parent[root];
+            representative[i] = root;
+        }
+        snapshot_detail::write<T>(path, snapshot_detail::Kind::DSU, n, 0,
+                                  {{representative.data(), representative.size() * sizeof(T)}});
+    }
+};
@@ -0,0 +1,104 @@
+/****************************************************************
+ * @file
+ * @brief Dynamic Segment Tree tests
+****************************************************************/
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include "dynamic_segment_tree.h"
+#include "segment_tree.h"
+
+int main(){
+    // region test 1
+    std::cout << "Test 1" << std::endl;
+    DynamicSegmentTree<long long> tree1(0, 1000000000000000000LL, [](long long a, long long b){return a + b;});
+    tree1.update(5, 10);
+    tree1.update(999999999999999999LL, 7);
+    tree1.update(123456789012345LL, 3);
+    std::cout << tree1.query(0, 1000000000000000000LL) << ", correct answer: " << 20 << std::endl;
+    std::cout << tree1.query(6, 999999999999999998LL) << ", correct answer: " << 3 << std::endl;
+    tree1.update(5, 1);
+    std::cout << tree1.query(0, 123456789012345LL) << ", correct answer: " << 4 << std::endl;
+    std::cout << "Nodes: " << tree1.nodes() << std::endl;
+    std::cout << std::endl;
+    // endregion
+
+    // region test 2
+    std::cout << "Test 2" << std::endl;
+    const std::int64_t min64 = std::numeric_limits<std::int64_t>::min(), max64 = std::numeric_limits<std::int64_t>::max();
+    DynamicSegmentTree<int> tree2(min64, max64, [](int a, int b){return std::min(a, b);},
+                                  std::numeric_limits<int>::max());
+    tree2.update(min64, 5);
+    tree2.update(max64, 3);
+    tree2.update(0, 4);
+    std::cout << tree2.query(min64, -1) << ", correct answer: " << 5 << std::endl;
+    std::cout << tree2.query(min64, max64) << ", correct answer: " << 3 << std::endl;
+    std::cout << tree2.query(1, max64 - 1) << ", correct answer: " << std::numeric_limits<int>::max() << std::endl;
+    try{
+        tree2.query(1, 0);
+        std::cout << "No error, correct answer: error" << std::endl;
+    }catch(const std::runtime_error &e){
+        std::cout << e.what() << ", correct answer: Invalid range" << std::endl;
+    }
+    std::cout << std::endl;
+    // endregion
+
+    // region test 3
+    std::cout << "Test 3" << std::endl;
+    std::vector<long long> timestamps = {1700000000000LL, 1600000000000LL, 1700000000000LL, 1650000000000LL};
+    CoordinateCompression<long long> compression(timestamps);
+    std::vector<int> counts(compression.size());
+    for(auto t : timestamps)
+        counts[compression.index(t)]++;
+    SegmentTree<int> tree3(counts, [](int a, int b){return a + b;});
+    std::cout << tree3.query(compression.index(1650000000000LL), compression.size() - 1)
+              << ", correct answer: " << 3 << std::endl;
+    std::cout << std::endl;
+    // endregion
+
+    // region random test
+    std::mt19937_64 rng(42);
+    bool ok = true;
+    for(std::int64_t range : {std::int64_t(1), std::int64_t(10), std::int64_t(1000), std::int64_t(1) << 60}){
+        std::map<std::int64_t, long long> values;
+        std::int64_t low = -range / 2, high = low + range - 1;
+        DynamicSegmentTree<long long> tree(low, high, [](long long a, long long b){return a + b;}, 0, 1000);
+        for(int step = 0; step < 1000; step++){
+            std::int64_t index = low + (std::int64_t) (rng() % (std::uint64_t) range);
+            long long value = (long long) (rng() % 1000);
+            tree.update(index, value);
+            values[index] = value;
+            std::int64_t l = low + (std::int64_t) (rng() % (std::uint64_t) range);
+            std::int64_t r = low + (std::int64_t) (rng() % (std::uint64_t) range);
+            if(l > r)
+                std::swap(l, r);
+            long long expected = 0;
+            for(auto it = values.lower_bound(l); it != values.end() && it->first <= r; ++it)
+                expected += it->second;
+            ok = ok && tree.query(l, r) == expected;
+        }
+    }
+    std::cout << "Random test" << std::endl;
+    if(ok)
+        std::cout << "Random test passed" << std::endl;
+    else
+        std::cout << "Random test failed" << std::endl;
+    std::cout << std::endl;
+    // endregion
+
+    // region memory
+    int points = 1000000;
+    DynamicSegmentTree<long long> tree(0, 1000000000000000000LL, [](long long a, long long b){return a + b;}, 0, points);
+    for(int i = 0; i < points; i++)
+        tree.update((std::int64_t) (rng() % 1000000000000000000ULL), 1);
+    std::cout << "Memory of " << points << " points in [0, 1e18]: " << tree.memory() / (1 << 20) << " MiB, "
+              << tree.nodes() << " nodes" << std::endl;
+    // endregion
+    return 0;
+}
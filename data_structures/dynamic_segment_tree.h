@@ -0,0 +1,235 @@
+/****************************************************************
+ * @file
+ * @brief Dynamic Segment Tree Data Structure
+ * @details
+ * A segment tree over a huge range of indices, e.g. 64-bit timestamps, where
+ * only a few positions are ever set. Nodes are created on the first update
+ * that reaches them, a missing node stands for a range of identity
+ * elements. A range with one point is a leaf that keeps the index of the
+ * point, so a new point adds a leaf and the inner nodes down to where it
+ * parts from its nearest point, not a full path of log U nodes. Nodes live
+ * in one contiguous pool and refer to their children by 32-bit indices.
+ *
+ * When all indices are known in advance, CoordinateCompression maps them to
+ * 0..k-1, and a dense SegmentTree or FenwickTree of size k can be used.
+ *
+ * ### Complexity
+ * Update : O(log U)
+ * Query : O(log U)
+ * Space Complexity : O(q*log U), about 2q nodes when points are spread out
+ * Where U is the size of the range of indices and q is the number of updates
+****************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+template <typename T>
+class DynamicSegmentTree{
+    struct Node{
+        T value;
+        std::int64_t index = 0;  // index of the point of a leaf
+        std::uint32_t left = 0, right = 0;  // indices of children in the pool, 0 if there is no child
+    };
+
+    std::int64_t low, high;  // range of indices, inclusive
+    std::vector<Node> pool;  // pool[0] is the root, it is never a leaf
+    T (*func)(T, T);  // function to use for range queries
+    T identity;  // result of an empty range
+
+    /**
+     * @brief Check if a node is a leaf, a subtree with one point
+     */
+    bool is_leaf(std::uint32_t node) const{
+        return node != 0 && pool[node].left == 0 && pool[node].right == 0;
+    }
+
+    /**
+     * @brief Add a node to the pool
+     * @returns index of the node
+     */
+    std::uint32_t new_node(T value, std::int64_t index){
+        if(pool.size() > UINT32_MAX)
+            throw std::runtime_error("Node pool is full");
+        pool.push_back({value, index});
+        return (std::uint32_t) (pool.size() - 1);
+    }
+
+    /**
+     * @brief Middle of a range, without overflow on the whole 64-bit range
+     */
+    static std::int64_t middle(std::int64_t left, std::int64_t right){
+        return left + (std::int64_t) (((std::uint64_t) right - (std::uint64_t) left) / 2);
+    }
+
+    /**
+     * @brief Query a subtree
+     * @param node - current node
+     * @param left - left border of the node
+     * @param right - right border of the node
+     * @param query_left - left border of the query, inside the node
+     * @param query_right - right border of the query, inside the node
+     * @returns result of the query
+     */
+    T query(std::uint32_t node, std::int64_t left, std::int64_t right,
+            std::int64_t query_left, std::int64_t query_right) const{
+        while(true){
+            const Node &cur = pool[node];
+            if(is_leaf(node))
+                return query_left <= cur.index && cur.index <= query_right ? cur.value : identity;
+            if(query_left == left && query_right == right)
+                return cur.value;
+            std::int64_t mid = middle(left, right);
+            if(query_right <= mid){
+                node = cur.left;
+                right = mid;
+            }else if(query_left > mid){
+                node = cur.right;
+                left = mid + 1;
+            }else{
+                T res = cur.left ? query(cur.left, left, mid, query_left, mid) : identity;
+                if(cur.right)
+                    res = func(res, query(cur.right, mid + 1, right, mid + 1, query_right));
+                return res;
+            }
+            if(node == 0)
+                return identity;
+        }
+    }
+
+public:
+    /**
+     * @brief Constructor of a range of identity elements
+     * @param low - first index
+     * @param high - last index, inclusive
+     * @param func - function to use for range queries
+     * @param identity - identity element of func
+     * @param updates - expected number of updates, to reserve the pool
+     */
+    DynamicSegmentTree(std::int64_t low, std::int64_t high, T (*func)(T, T), T identity = T{},
+                       std::size_t updates = 0) : low(low), high(high), func(func), identity(identity){
+        if(low > high)
+            throw std::runtime_error("Invalid range");
+        // a leaf and an inner node per point when points are spread out
+        pool.reserve(1 + 2 * updates);
+        new_node(identity, 0);
+    }
+
+    /**
+     * @brief Set a value
+     * @param index - index to update
+     * @param value - value to update
+     */
+    void update(std::int64_t index, T value){
+        if(index < low || index > high)
+            throw std::runtime_error("Index out of range");
+        std::uint32_t path[64];  // inner nodes from the root down, the depth is at most 64
+        int depth = 0;
+        std::uint32_t node = 0;
+        std::int64_t left = low, right = high;
+        while(true){
+            path[depth++] = node;
+            std::int64_t mid = middle(left, right);
+            bool go_left = index <= mid;
+            std::uint32_t child = go_left ? pool[node].left : pool[node].right;
+            if(go_left)
+                right = mid;
+            else
+                left = mid + 1;
+            // the new node may move the pool, so links are written after it is created
+            if(child == 0){
+                child = new_node(value, index);
+                (go_left ? pool[node].left : pool[node].right) = child;
+                break;
+            }
+            if(is_leaf(child)){
+                if(pool[child].index == index){
+                    pool[child].value = value;
+                    break;
+                }
+                // two points share the range of the leaf, it moves one level down under a new inner node
+                std::uint32_t inner = new_node(identity, 0);
+                std::int64_t leaf_index = pool[child].index;
+                (leaf_index <= middle(left, right) ? pool[inner].left : pool[inner].right) = child;
+                (go_left ? pool[node].left : pool[node].right) = inner;
+                child = inner;
+            }
+            node = child;
+        }
+        while(depth > 0){
+            Node &parent = pool[path[--depth]];
+            T left_value = parent.left ? pool[parent.left].value : identity;
+            T right_value = parent.right ? pool[parent.right].value : identity;
+            parent.value = func(left_value, right_value);
+        }
+    }
+
+    /**
+     * @brief Query the tree
+     * @param left - left border of the query
+     * @param right - right border of the query, inclusive
+     * @returns result of the query
+     */
+    T query(std::int64_t left, std::int64_t right) const{
+        if(left < low || right > high || left > right)
+            throw std::runtime_error("Invalid range");
+        return query(0, low, high, left, right);
+    }
+
+    /**
+     * @brief Get the number of nodes in the pool
+     */
+    std::size_t nodes() const{
+        return pool.size();
+    }
+
+    /**
+     * @brief Get the memory used by the nodes in bytes
+     */
+    std::size_t memory() const{
+        return pool.size() * sizeof(Node);
+    }
+};
+
+template <typename T>
+class CoordinateCompression{
+    std::vector<T> values;  // sorted distinct coordinates
+
+public:
+    /**
+     * @brief Constructor
+     * @param coordinates - all coordinates that will be used, in any order, with repeats
+     */
+    explicit CoordinateCompression(std::vector<T> coordinates) : values(std::move(coordinates)){
+        std::sort(values.begin(), values.end());
+        values.erase(std::unique(values.begin(), values.end()), values.end());
+    }
+
+    /**
+     * @brief Get the compressed index of a coordinate
+     * @param x - coordinate
+     * @returns number of distinct coordinates less than x, the index of x if it is known
+     */
+    int index(const T &x) const{
+        return (int) (std::lower_bound(values.begin(), values.end(), x) - values.begin());
+    }
+
+    /**
+     * @brief Get the coordinate of a compressed index
+     */
+    const T &value(int i) const{
+        return values[i];
+    }
+
+    /**
+     * @brief Get the number of distinct coordinates
+     */
+    int size() const{
+        return (int) values.size();
+    }
+};
@@ -0,0 +1,116 @@
+/****************************************************************
+ * @file
+ * @brief Fenwick Tree tests
+****************************************************************/
+
+#include <iostream>
+#include <random>
+#include <vector>
+#include "fenwick_tree.h"
+
+int main(){
+    // region test 1
+    std::cout << "Test 1" << std::endl;
+    std::vector<int> arr1 = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    FenwickTree<int> tree1(arr1);
+    std::cout << tree1.query(0, 9) << ", correct answer: " << 55 << std::endl;
+    tree1.add(0, 9);
+    std::cout << tree1.query(0, 9) << ", correct answer: " << 64 << std::endl;
+    std::cout << tree1.query(2, 4) << ", correct answer: " << 12 << std::endl;
+    std::cout << "First prefix reaching 20: " << tree1.lower_bound(20) << ", correct answer: " << 4 << std::endl;
+    std::cout << std::endl;
+    // endregion
+
+    // region test 2
+    std::cout << "Test 2" << std::endl;
+    RangeFenwickTree<long long> tree2(std::vector<long long>{1, 2, 3, 4, 5});
+    tree2.range_add(1, 3, 10);
+    std::cout << tree2.query(0, 4) << ", correct answer: " << 45 << std::endl;
+    std::cout << tree2.get(2) << ", correct answer: " << 13 << std::endl;
+    std::cout << std::endl;
+    // endregion
+
+    // region test 3
+    std::cout << "Test 3" << std::endl;
+    FenwickTree2D<int> tree3({{1, 2, 3}, {4, 5, 6}, {7, 8, 9}});
+    std::cout << tree3.query(1, 1, 2, 2) << ", correct answer: " << 28 << std::endl;
+    tree3.add(2, 2, -9);
+    std::cout << tree3.query(0, 0, 2, 2) << ", correct answer: " << 36 << std::endl;
+    std::cout << std::endl;
+    // endregion
+
+    // region random test
+    std::mt19937 rng(42);
+    bool ok = true;
+    for(int n : {1, 2, 3, 17, 1000, 3000}){
+        std::vector<long long> arr(n);
+        for(auto &x : arr)
+            x = rng() % 100;
+        FenwickTree<long long> point(arr);
+        RangeFenwickTree<long long> range(arr);
+        std::vector<long long> range_arr = arr;
+        FenwickTree<unsigned, std::bit_xor<>, std::bit_xor<>> xor_tree(n);
+        std::vector<unsigned> xor_arr(n, 0);
+        for(int step = 0; step < 500; step++){
+            int l = (int) (rng() % n), r = (int) (rng() % n);
+            if(l > r)
+                std::swap(l, r);
+            long long sum = 0, range_sum = 0;
+            unsigned xor_sum = 0;
+            for(int i = l; i <= r; i++){
+                sum += arr[i];
+                range_sum += range_arr[i];
+                xor_sum ^= xor_arr[i];
+            }
+            ok = ok && point.query(l, r) == sum && range.query(l, r) == range_sum && xor_tree.query(l, r) == xor_sum;
+            long long target = rng() % (60 * n);
+            int expected = 0;
+            for(long long prefix = 0; expected < n && prefix + arr[expected] < target; expected++)
+                prefix += arr[expected];
+            ok = ok && point.lower_bound(target) == expected;
+
+            int index = (int) (rng() % n);
+            long long value = rng() % 100;
+            point.set(index, value);
+            arr[index] = value;
+            long long delta = (long long) (rng() % 21) - 10;
+            range.range_add(l, r, delta);
+            for(int i = l; i <= r; i++)
+                range_arr[i] += delta;
+            unsigned bits = (unsigned) rng();
+            xor_tree.add(index, bits);
+            xor_arr[index] ^= bits;
+        }
+    }
+    for(int rows : {1, 5, 40})
+        for(int cols : {1, 7, 33}){
+            std::vector<std::vector<int>> grid(rows, std::vector<int>(cols));
+            for(auto &row : grid)
+                for(auto &x : row)
+                    x = (int) (rng() % 100);
+            FenwickTree2D<int> tree(grid);
+            for(int step = 0; step < 200; step++){
+                int r1 = (int) (rng() % rows), r2 = (int) (rng() % rows);
+                int c1 = (int) (rng() % cols), c2 = (int) (rng() % cols);
+                if(r1 > r2)
+                    std::swap(r1, r2);
+                if(c1 > c2)
+                    std::swap(c1, c2);
+                int sum = 0;
+                for(int r = r1; r <= r2; r++)
+                    for(int c = c1; c <= c2; c++)
+                        sum += grid[r][c];
+                ok = ok && tree.query(r1, c1, r2, c2) == sum;
+                int r = (int) (rng() % rows), c = (int) (rng() % cols), delta = (int) (rng() % 10);
+                tree.add(r, c, delta);
+                grid[r][c] += delta;
+            }
+        }
+    std::cout << "Random test" << std::endl;
+    if(ok)
+        std::cout << "Random test passed" << std::endl;
+    else
+        std::cout << "Random test failed" << std::endl;
+    // endregion
+    return 0;
+}
@@ -0,0 +1,301 @@
+/****************************************************************
+ * @file
+ * @brief Fenwick Tree (Binary Indexed Tree) Data Structures
+ * @details
+ * A Fenwick tree keeps prefix sums of an array under point updates in n
+ * values: the i-th value (1-based) is the sum of the last lowbit(i) elements
+ * up to i. It needs an invertible operation (sum, xor), so a range is the
+ * difference of two prefixes. Compared to SegmentTree it takes n instead of
+ * 4n values in one array and its loops have no recursion. Prefix queries
+ * only depend on the index, so the loads of a query do not wait for each
+ * other.
+ *
+ * 1) FenwickTree: point add, prefix and range sum, lower_bound by prefix sum.
+ * 2) RangeFenwickTree: range add and range sum with two trees: adding d to
+ * [l, n) adds d*(i+1) - d*l to the prefix sum up to i.
+ * 3) FenwickTree2D: point add and rectangle sum.
+ *
+ * ### Complexity
+ * Build : O(n), O(n*m) for 2D
+ * Update : O(log n), O(log n * log m) for 2D
+ * Query : O(log n), O(log n * log m) for 2D
+ * Lower bound : O(log n)
+ * Space Complexity : O(n), O(n*m) for 2D
+****************************************************************/
+
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <functional>
+#include <vector>
+
+template <typename T, typename Add = std::plus<>, typename Sub = std::minus<>>
+class FenwickTree{
+    int n;  // size of the array
+    std::vector<T> tree;  // tree[i] is the result of elements (i - lowbit(i), i], 1-based
+    Add add_op;  // operation, T{} must be its identity
+    Sub sub_op;  // inverse of the operation
+
+public:
+    /**
+     * @brief Constructor of a tree of identity elements
+     * @param size - size of the array
+     */
+    explicit FenwickTree(int size) : n(size), tree(size + 1, T{}){}
+
+    /**
+     * @brief Constructor, builds the tree in place in O(n)
+     * @param arr - input array
+     */
+    explicit FenwickTree(const std::vector<T> &arr) : FenwickTree((int) arr.size()){
+        for(int i = 1; i <= n; i++)
+            tree[i] = arr[i - 1];
+        // every value is complete when it is added to its parent
+        for(int i = 1; i <= n; i++){
+            int parent = i + (i & -i);
+            if(parent <= n)
+                tree[parent] = add_op(tree[parent], tree[i]);
+        }
+    }
+
+    /**
+     * @brief Add to an element
+     * @param index - index of the element
+     * @param delta - value to add
+     */
+    void add(int index, T delta){
+        for(int i = index + 1; i <= n; i += i & -i)
+            tree[i] = add_op(tree[i], delta);
+    }
+
+    /**
+     * @brief Set an element
+     * @param index - index of the element
+     * @param value - new value
+     */
+    void set(int index, T value){
+        add(index, sub_op(value, get(index)));
+    }
+
+    /**
+     * @brief Prefix query
+     * @param right - right border of the prefix, inclusive, -1 for the empty prefix
+     * @returns result of elements from 0 to right
+     */
+    T prefix_query(int right) const{
+        T res{};
+        for(int i = right + 1; i > 0; i -= i & -i)
+            res = add_op(res, tree[i]);
+        return res;
+    }
+
+    /**
+     * @brief Range query
+     * @param left - left border of the range
+     * @param right - right border of the range, inclusive
+     * @returns result of elements from left to right
+     */
+    T query(int left, int right) const{
+        return sub_op(prefix_query(right), prefix_query(left - 1));
+    }
+
+    /**
+     * @brief Get an element
+     */
+    T get(int index) const{
+        return query(index, index);
+    }
+
+    /**
+     * @brief Find the first prefix that reaches a value
+     * @details elements must not be negative, so prefix sums do not decrease
+     * @param value - value to reach
+     * @returns the first index i such that prefix_query(i) >= value, size if there is none
+     */
+    int lower_bound(T value) const{
+        int pos = 0;  // prefix of pos elements is less than value
+        T acc{};
+        for(int step = n ? (int) std::bit_floor((unsigned) n) : 0; step > 0; step >>= 1){
+            if(pos + step <= n){
+                T next = add_op(acc, tree[pos + step]);
+                if(next < value){
+                    pos += step;
+                    acc = next;
+                }
+            }
+        }
+        return pos;
+    }
+
+    /**
+     * @brief Get the size of the array
+     */
+    int size() const{
+        return n;
+    }
+};
+
+template <typename T>
+class RangeFenwickTree{
+    FenwickTree<T> diff;  // d[i] = a[i] - a[i - 1]
+    FenwickTree<T> weighted;  // d[i] * i
+
+    /**
+     * @brief Build the difference arrays of an array
+     */
+    static std::vector<T> differences(const std::vector<T> &arr, bool weighted){
+        std::vector<T> res(arr.size());
+        for(std::size_t i = 0; i < arr.size(); i++){
+            res[i] = i ? arr[i] - arr[i - 1] : arr[i];
+            if(weighted)
+                res[i] = res[i] * (T) i;
+        }
+        return res;
+    }
+
+public:
+    /**
+     * @brief Constructor of a tree of zeros
+     * @param size - size of the array
+     */
+    explicit RangeFenwickTree(int size) : diff(size), weighted(size){}
+
+    /**
+     * @brief Constructor, builds the trees in O(n)
+     * @param arr - input array
+     */
+    explicit RangeFenwickTree(const std::vector<T> &arr)
+            : diff(differences(arr, false)), weighted(differences(arr, true)){}
+
+    /**
+     * @brief Add to a range
+     * @param left - left border of the range
+     * @param right - right border of the range, inclusive
+     * @param delta - value to add to every element
+     */
+    void range_add(int left, int right, T delta){
+        diff.add(left, delta);
+        diff.add(right + 1, -delta);
+        weighted.add(left, delta * (T) left);
+        weighted.add(right + 1, -delta * (T) (right + 1));
+    }
+
+    /**
+     * @brief Prefix sum
+     * @param right - right border of the prefix, inclusive, -1 for the empty prefix
+     * @returns sum of elements from 0 to right
+     */
+    T prefix_query(int right) const{
+        return diff.prefix_query(right) * (T) (right + 1) - weighted.prefix_query(right);
+    }
+
+    /**
+     * @brief Range sum
+     * @param left - left border of the range
+     * @param right - right border of the range, inclusive
+     * @returns sum of elements from left to right
+     */
+    T query(int left, int right) const{
+        return prefix_query(right) - prefix_query(left - 1);
+    }
+
+    /**
+     * @brief Get an element
+     */
+    T get(int index) const{
+        return diff.prefix_query(index);
+    }
+
+    /**
+     * @brief Get the size of the array
+     */
+    int size() const{
+        return diff.size();
+    }
+};
+
+template <typename T>
+class FenwickTree2D{
+    int rows, cols;
+    std::vector<T> tree;  // (rows + 1) x (cols + 1), row-major, 1-based
+
+    T &node(int r, int c){
+        return tree[(std::size_t) r * (cols + 1) + c];
+    }
+
+    const T &node(int r, int c) const{
+        return tree[(std::size_t) r * (cols + 1) + c];
+    }
+
+public:
+    /**
+     * @brief Constructor of a grid of zeros
+     * @param rows - number of rows
+     * @param cols - number of columns
+     */
+    FenwickTree2D(int rows, int cols) : rows(rows), cols(cols), tree((std::size_t) (rows + 1) * (cols + 1), T{}){}
+
+    /**
+     * @brief Constructor, builds the tree in place in O(rows * cols)
+     * @param grid - input grid, all rows of the same length
+     */
+    explicit FenwickTree2D(const std::vector<std::vector<T>> &grid)
+            : FenwickTree2D((int) grid.size(), grid.empty() ? 0 : (int) grid[0].size()){
+        for(int r = 1; r <= rows; r++)
+            for(int c = 1; c <= cols; c++)
+                node(r, c) = grid[r - 1][c - 1];
+        // build along rows, then along columns
+        for(int r = 1; r <= rows; r++)
+            for(int c = 1; c <= cols; c++){
+                int parent = c + (c & -c);
+                if(parent <= cols)
+                    node(r, parent) += node(r, c);
+            }
+        for(int r = 1; r <= rows; r++){
+            int parent = r + (r & -r);
+            if(parent <= rows)
+                for(int c = 1; c <= cols; c++)
+                    node(parent, c) += node(r, c);
+        }
+    }
+
+    /**
+     * @brief Add to an element
+     * @param row - row of the element
+     * @param col - column of the element
+     * @param delta - value to add
+     */
+    void add(int row, int col, T delta){
+        for(int r = row + 1; r <= rows; r += r & -r)
+            for(int c = col + 1; c <= cols; c += c & -c)
+                node(r, c) += delta;
+    }
+
+    /**
+     * @brief Prefix sum
+     * @param row - last row, inclusive, -1 for the empty prefix
+     * @param col - last column, inclusive, -1 for the empty prefix
+     * @returns sum of the rectangle from (0, 0) to (row, col)
+     */
+    T prefix_query(int row, int col) const{
+        T res{};
+        for(int r = row + 1; r > 0; r -= r & -r)
+            for(int c = col + 1; c > 0; c -= c & -c)
+                res += node(r, c);
+        return res;
+    }
+
+    /**
+     * @brief Rectangle sum
+     * @param row1 - first row
+     * @param col1 - first column
+     * @param row2 - last row, inclusive
+     * @param col2 - last column, inclusive
+     * @returns sum of the rectangle
+     */
+    T query(int row1, int col1, int row2, int col2) const{
+        return prefix_query(row2, col2) - prefix_query(row1 - 1, col2)
+               - prefix_query(row2, col1 - 1) + prefix_query(row1 - 1, col1 - 1);
+    }
+};
@@ -0,0 +1,111 @@
+/****************************************************************
+ * @file
+ * @brief MultiQueue tests
+****************************************************************/
+
+#include <algorithm>
+#include <chrono>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <vector>
+#include "multi_queue.h"
+
+bool less(int a, int b){
+    return a < b;
+}
+
+int main(){
+    // region test 1
+    std::cout << "Test 1" << std::endl;
+    // one shard is an exact priority queue
+    MultiQueue<int> queue1(1, less, 1);
+    for(int x : {5, 1, 4, 2, 3})
+        queue1.push(x);
+    std::cout << "Pops:";
+    while(auto x = queue1.pop())
+        std::cout << " " << *x;
+    std::cout << ", correct answer: 1 2 3 4 5" << std::endl;
+    std::cout << std::endl;
+    // endregion
+
+    // region test 2
+    std::cout << "Test 2" << std::endl;
+    MultiQueue<int> queue2(4, less);
+    std::cout << "Shards: " << queue2.shard_count() << ", correct answer: 8" << std::endl;
+    std::cout << "Pop from empty: " << queue2.pop().has_value() << ", correct answer: 0" << std::endl;
+    std::cout << std::endl;
+    // endregion
+
+    // region random test
+    // threads push distinct elements and pop concurrently, nothing may be lost or popped twice
+    bool ok = true;
+    for(int threads : {1, 2, 4, 8}){
+        MultiQueue<int> queue(threads, less);
+        const int per_thread = 20000;
+        std::vector<std::vector<int>> popped(threads);
+        std::vector<std::thread> workers;
+        for(int t = 0; t < threads; t++)
+            workers.emplace_back([&, t]{
+                for(int i = 0; i < per_thread; i++){
+                    queue.push(t * per_thread + i);
+                    if(i % 2)
+                        if(auto x = queue.pop())
+                            popped[t].push_back(*x);
+                }
+            });
+        for(auto &worker : workers)
+            worker.join();
+        std::vector<int> all;
+        for(auto &part : popped)
+            all.insert(all.end(), part.begin(), part.end());
+        ok = ok && queue.size() == threads * per_thread - all.size();
+        while(auto x = queue.pop())
+            all.push_back(*x);
+        std::sort(all.begin(), all.end());
+        for(int i = 0; i < threads * per_thread; i++)
+            ok = ok && i < (int) all.size() && all[i] == i;
+        ok = ok && (int) all.size() == threads * per_thread;
+    }
+    std::cout << "Random test " << (ok ? "passed" : "failed") << std::endl;
+    std::cout << std::endl;
+    // endregion
+
+    // region throughput
+    // every thread pops an element and pushes a later one, compared with one heap behind one lock
+    const int ops = 1 << 20;
+    for(int threads : {1, 2, 4, 8}){
+        std::vector<int> initial(1 << 16);
+        for(int i = 0; i < (int) initial.size(); i++)
+            initial[i] = i;
+        MultiQueue<int> queue(threads, less);
+        for(int x : initial)
+            queue.push(x);
+        BinaryHeap<int> heap(initial, less);
+        std::mutex heap_mutex;
+        auto measure = [&](auto &&hold){
+            auto start = std::chrono::steady_clock::now();
+            std::vector<std::thread> workers;
+            for(int t = 0; t < threads; t++)
+                workers.emplace_back([&, t]{
+                    for(int i = t; i < ops; i += threads)
+                        hold(i);
+                });
+            for(auto &worker : workers)
+                worker.join();
+            return ops / std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count() / 1e6;
+        };
+        double multi = measure([&](int i){
+            if(auto x = queue.pop())
+                queue.push(*x + 1 + i % 1024);
+        });
+        double locked = measure([&](int i){
+            std::lock_guard lock(heap_mutex);
+            heap.add(heap.pop() + 1 + i % 1024);
+        });
+        std::cout << threads << " threads: multi queue " << multi << " Mop/s, locked heap " << locked << " Mop/s"
+                  << std::endl;
+    }
+    // endregion
+    return 0;
+}
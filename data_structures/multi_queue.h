@@ -0,0 +1,182 @@
+/****************************************************************
+ * @file
+ * @brief MultiQueue (Relaxed Concurrent Priority Queue) Data Structure
+ * @details
+ * A priority queue for many threads (Rihani, Sanders, Dementiev). One locked
+ * heap serializes all threads, so the elements are spread over c*p BinaryHeap
+ * shards for p threads instead, each behind its own lock:
+ * - push locks a random shard with try_lock, another one is picked if the
+ * lock is taken, and adds the element there
+ * - pop looks at the lead elements of two random shards and takes the better
+ * one under try_lock of its shard
+ * No thread waits for a lock while shards are not empty.
+ *
+ * The queue is relaxed: pop returns an element close to the lead one but not
+ * always the lead one. The rank error, the number of better elements in the
+ * queue at the time of a pop, is O(c*p) on average and does not grow with the
+ * number of elements. A larger c lowers contention, a smaller one the error.
+ *
+ * Every shard keeps a copy of its lead element and of its size in atomics,
+ * so shards are compared without their locks, T must be trivially copyable.
+ * The copies are refreshed under the lock after every change of the heap.
+ *
+ * ### Complexity
+ * Push : O(logn) expected
+ * Pop : O(logn) expected
+ * Space Complexity : O(n + c*p)
+ * Where n is the number of elements and p is the number of threads
+****************************************************************/
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <stdexcept>
+#include <type_traits>
+#include <vector>
+#include "binary_heap.h"
+
+namespace multi_queue_detail{
+    /**
+     * @brief Random number of the calling thread, xorshift with a seed for every thread
+     */
+    inline std::uint64_t random(){
+        static std::atomic<std::uint64_t> seeds{0x9E3779B97F4A7C15};
+        thread_local std::uint64_t state = seeds.fetch_add(0x9E3779B97F4A7C15, std::memory_order_relaxed) | 1;
+        state ^= state << 13;
+        state ^= state >> 7;
+        state ^= state << 17;
+        return state;
+    }
+}
+
+template <typename T>
+class MultiQueue{
+    static_assert(std::is_trivially_copyable_v<T>, "Lead elements of shards are atomics, T must be trivially copyable");
+
+    struct alignas(64) Shard{
+        std::mutex mutex;
+        BinaryHeap<T> heap;
+        std::atomic<T> top{};  // lead element of heap, read without the lock
+        std::atomic<int> size{0};  // size of heap, read without the lock
+
+        Shard(std::vector<T> &arr, bool (*f)(T, T)) : heap(arr, f){}
+    };
+
+    std::vector<std::unique_ptr<Shard>> shards;
+    bool (*func)(T, T);  // function to use for comparision queries
+
+    /**
+     * @brief Get a random shard
+     */
+    Shard &random_shard() const{
+        return *shards[multi_queue_detail::random() % shards.size()];
+    }
+
+    /**
+     * @brief Refresh the copies of the lead element and the size, the lock of the shard is held
+     */
+    static void publish(Shard &shard){
+        int size = shard.heap.size();
+        if(size)
+            shard.top.store(shard.heap.get(), std::memory_order_relaxed);
+        shard.size.store(size, std::memory_order_release);
+    }
+
+    /**
+     * @brief Pop from the first shard that is not empty, waiting for the locks
+     * @returns nullopt if all shards are empty
+     */
+    std::optional<T> pop_any(){
+        std::size_t start = multi_queue_detail::random() % shards.size();
+        for(std::size_t i = 0; i < shards.size(); i++){
+            Shard &shard = *shards[(start + i) % shards.size()];
+            std::lock_guard lock(shard.mutex);
+            if(shard.heap.size() == 0)
+                continue;
+            T res = shard.heap.pop();
+            publish(shard);
+            return res;
+        }
+        return std::nullopt;
+    }
+
+public:
+    /**
+     * @brief Constructor
+     * @param threads - number of threads that use the queue
+     * @param f - function to use for comparision queries
+     * @param c - shards per thread
+     */
+    MultiQueue(int threads, bool (*f)(T, T), int c = 2) : func(f){
+        if(threads < 1 || c < 1)
+            throw std::runtime_error("Invalid number of shards");
+        std::vector<T> none;
+        for(int i = 0; i < c * threads; i++)
+            shards.push_back(std::make_unique<Shard>(none, f));
+    }
+
+    /**
+     * @brief Add element to the queue
+     * @param val - element to add
+     */
+    void push(T val){
+        while(true){
+            Shard &shard = random_shard();
+            std::unique_lock lock(shard.mutex, std::try_to_lock);
+            if(!lock)
+                continue;
+            shard.heap.add(val);
+            publish(shard);
+            return;
+        }
+    }
+
+    /**
+     * @brief Get and remove an element close to the lead one
+     * @returns the element, nullopt if the queue is empty
+     */
+    std::optional<T> pop(){
+        std::size_t misses = 0;  // tries that found both shards empty
+        while(misses < shards.size()){
+            Shard *a = &random_shard(), *b = &random_shard();
+            bool has_a = a->size.load(std::memory_order_acquire) > 0;
+            bool has_b = b->size.load(std::memory_order_acquire) > 0;
+            if(!has_a && !has_b){
+                misses++;
+                continue;
+            }
+            Shard *best = !has_b || (has_a && !func(b->top.load(std::memory_order_relaxed),
+                                                   a->top.load(std::memory_order_relaxed))) ? a : b;
+            std::unique_lock lock(best->mutex, std::try_to_lock);
+            if(!lock || best->heap.size() == 0)
+                continue;
+            T res = best->heap.pop();
+            publish(*best);
+            return res;
+        }
+        // the queue looks empty, make sure of it
+        return pop_any();
+    }
+
+    /**
+     * @brief Get the number of elements, exact only when no thread changes the queue
+     */
+    std::size_t size() const{
+        std::size_t total = 0;
+        for(auto &shard : shards)
+            total += shard->size.load(std::memory_order_relaxed);
+        return total;
+    }
+
+    /**
+     * @brief Get the number of shards
+     */
+    int shard_count() const{
+        return shards.size();
+    }
+};
@@ -0,0 +1,92 @@
+/****************************************************************
+ * @file
+ * @brief Persistent Segment Tree tests
+****************************************************************/
+
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include "persistent_segment_tree.h"
+#include "segment_tree.h"
+
+int main(){
+    // region test 1
+    std::cout << "Test 1" << std::endl;
+    std::vector<int> arr1 = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    PersistentSegmentTree<int> tree1(arr1, [](int a, int b){return a + b;});
+    int v1 = tree1.update(0, 0, 10);
+    int v2 = tree1.update(v1, 9, 0);
+    std::cout << tree1.query(0, 0, 9) << ", correct answer: " << 55 << std::endl;
+    std::cout << tree1.query(v1, 0, 9) << ", correct answer: " << 64 << std::endl;
+    std::cout << tree1.query(v2, 0, 9) << ", correct answer: " << 54 << std::endl;
+    std::cout << tree1.query(v2, 1, 8) << ", correct answer: " << 44 << std::endl;
+    std::cout << std::endl;
+    // endregion
+
+    // region test 2
+    std::cout << "Test 2" << std::endl;
+    std::vector<int> arr2 = {5, 7, 8, 1, 12, 3, 3, 3, 4, 1, 9, 7};
+    PersistentSegmentTree<int> tree2(arr2, [](int a, int b){return std::max(a, b);});
+    tree2.update(4, 0);
+    int branch = tree2.update(0, 5, 100);  // a second branch from version 0
+    std::cout << tree2.query(1, 3, 11) << ", correct answer: " << 9 << std::endl;
+    std::cout << tree2.query(branch, 3, 11) << ", correct answer: " << 100 << std::endl;
+    std::cout << tree2.query(0, 3, 11) << ", correct answer: " << 12 << std::endl;
+    try{
+        tree2.update(0, 12, 1);
+        std::cout << "No error, correct answer: error" << std::endl;
+    }catch(const std::runtime_error &e){
+        std::cout << e.what() << ", correct answer: Index out of range" << std::endl;
+    }
+    std::cout << tree2.latest() << ", correct answer: " << 2 << std::endl;
+    std::cout << std::endl;
+    // endregion
+
+    // region random test
+    std::mt19937 rng(42);
+    bool ok = true;
+    for(int n : {1, 2, 3, 17, 1000}){
+        std::vector<int> arr(n);
+        for(auto &x : arr)
+            x = (int) (rng() % 1000);
+        std::vector<std::vector<int>> versions = {arr};
+        PersistentSegmentTree<int> tree(arr, [](int a, int b){return a + b;}, 2000);
+        for(int step = 0; step < 2000; step++){
+            int version = (int) (rng() % versions.size());
+            int l = (int) (rng() % n), r = (int) (rng() % n);
+            if(l > r)
+                std::swap(l, r);
+            int expected = 0;
+            for(int i = l; i <= r; i++)
+                expected += versions[version][i];
+            ok = ok && tree.query(version, l, r) == expected;
+            int index = (int) (rng() % n), value = (int) (rng() % 1000);
+            versions.push_back(versions[version]);
+            versions.back()[index] = value;
+            ok = ok && tree.update(version, index, value) == (int) versions.size() - 1;
+        }
+    }
+    std::cout << "Random test" << std::endl;
+    if(ok)
+        std::cout << "Random test passed" << std::endl;
+    else
+        std::cout << "Random test failed" << std::endl;
+    std::cout << std::endl;
+    // endregion
+
+    // region memory
+    int n = 1 << 20, updates = 1000;
+    std::vector<int> arr(n, 1);
+    PersistentSegmentTree<int> tree(arr, [](int a, int b){return a + b;}, updates);
+    std::size_t initial = tree.memory();
+    for(int i = 0; i < updates; i++)
+        tree.update((int) (rng() % n), 2);
+    std::cout << "Memory of " << updates << " versions of " << n << " elements" << std::endl;
+    std::cout << "Persistent tree: " << tree.memory() / 1024 << " KiB, "
+              << (tree.memory() - initial) / updates << " bytes per version" << std::endl;
+    std::cout << "Copies of SegmentTree: " << (std::size_t) updates * 4 * n * sizeof(int) / 1024 << " KiB" << std::endl;
+    // endregion
+    return 0;
+}
@@ -0,0 +1,201 @@
+/****************************************************************
+ * @file
+ * @brief Persistent Segment Tree Data Structure
+ * @details
+ * A persistent segment tree keeps every version of the array. An update
+ * does not change nodes, it copies the path from the root to the leaf and
+ * returns the root of a new version, the other nodes are shared with the
+ * previous version. Queries run on any version.
+ *
+ * Nodes live in one contiguous pool and refer to their children by 32-bit
+ * indices, so a node is the value and 8 bytes, and there is no allocation
+ * per node.
+ *
+ * ### Complexity
+ * Build : O(n)
+ * Update : O(log n), log n + 1 new nodes
+ * Query : O(log n)
+ * Space Complexity : O(n + u*log n)
+ * Where n is the size of the array and u is the number of updates
+****************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+template <typename T>
+class PersistentSegmentTree{
+    struct Node{
+        T value;
+        std::uint32_t left, right;  // indices of children in the pool, unused in leaves
+    };
+
+    int size;
+    std::vector<Node> pool;
+    std::vector<std::uint32_t> roots;  // roots[v] is the root of version v
+    T (*func)(T, T);  // function to use for range queries
+
+    /**
+     * @brief Add a node to the pool
+     * @returns index of the node
+     */
+    std::uint32_t new_node(T value, std::uint32_t left, std::uint32_t right){
+        if(pool.size() > UINT32_MAX)
+            throw std::runtime_error("Node pool is full");
+        pool.push_back({value, left, right});
+        return (std::uint32_t) (pool.size() - 1);
+    }
+
+    /**
+     * @brief Build the tree of the first version
+     * @param arr - array to build the tree from
+     * @param left - left border of the array
+     * @param right - right border of the array
+     * @returns index of the node
+     */
+    std::uint32_t build(const std::vector<T> &arr, int left, int right){
+        if(left == right)
+            return new_node(arr[left], 0, 0);
+        int mid = (left + right) / 2;
+        std::uint32_t l = build(arr, left, mid);
+        std::uint32_t r = build(arr, mid + 1, right);
+        return new_node(func(pool[l].value, pool[r].value), l, r);
+    }
+
+    /**
+     * @brief Copy the path to a leaf with a new value
+     * @param node - node of the old version
+     * @param left - left border of the node
+     * @param right - right border of the node
+     * @param index - index to update
+     * @param value - value to update
+     * @returns index of the new node
+     */
+    std::uint32_t update(std::uint32_t node, int left, int right, int index, T value){
+        if(left == right)
+            return new_node(value, 0, 0);
+        int mid = (left + right) / 2;
+        std::uint32_t l = pool[node].left, r = pool[node].right;
+        if(index <= mid)
+            l = update(l, left, mid, index, value);
+        else
+            r = update(r, mid + 1, right, index, value);
+        return new_node(func(pool[l].value, pool[r].value), l, r);
+    }
+
+    /**
+     * @brief Query a subtree
+     * @param node - current node
+     * @param left - left border of the node
+     * @param right - right border of the node
+     * @param query_left - left border of the query, inside the node
+     * @param query_right - right border of the query, inside the node
+     * @returns result of the query
+     */
+    T query(std::uint32_t node, int left, int right, int query_left, int query_right) const{
+        while(query_left != left || query_right != right){
+            int mid = (left + right) / 2;
+            if(query_right <= mid){
+                node = pool[node].left;
+                right = mid;
+            }else if(query_left > mid){
+                node = pool[node].right;
+                left = mid + 1;
+            }else{
+                return func(query(pool[node].left, left, mid, query_left, mid),
+                            query(pool[node].right, mid + 1, right, mid + 1, query_right));
+            }
+        }
+        return pool[node].value;
+    }
+
+public:
+    /**
+     * @brief Constructor, the array becomes version 0
+     * @param arr - array to build the tree from, not empty
+     * @param func - function to use for range queries
+     * @param updates - expected number of updates, to reserve the pool
+     */
+    PersistentSegmentTree(const std::vector<T> &arr, T (*func)(T, T), std::size_t updates = 0){
+        if(arr.empty())
+            throw std::runtime_error("Array is empty");
+        size = arr.size();
+        this->func = func;
+        std::size_t depth = 1;
+        while((std::size_t(1) << (depth - 1)) < arr.size())
+            depth++;
+        pool.reserve(2 * arr.size() - 1 + updates * depth);
+        roots.push_back(build(arr, 0, size - 1));
+    }
+
+    /**
+     * @brief Set a value in a version
+     * @param version - version to change
+     * @param index - index to update
+     * @param value - value to update
+     * @returns the new version, the old one does not change
+     */
+    int update(int version, int index, T value){
+        if(index < 0 || index >= size)
+            throw std::runtime_error("Index out of range");
+        roots.push_back(update(roots.at(version), 0, size - 1, index, value));
+        return (int) roots.size() - 1;
+    }
+
+    /**
+     * @brief Set a value in the latest version
+     * @param index - index to update
+     * @param value - value to update
+     * @returns the new version
+     */
+    int update(int index, T value){
+        return update(latest(), index, value);
+    }
+
+    /**
+     * @brief Query a version
+     * @param version - version to query
+     * @param left - left border of the query
+     * @param right - right border of the query, inclusive
+     * @returns result of the query
+     */
+    T query(int version, int left, int right) const{
+        if(left < 0 || right >= size || left > right)
+            throw std::runtime_error("Invalid range");
+        return query(roots.at(version), 0, size - 1, left, right);
+    }
+
+    /**
+     * @brief Query the latest version
+     * @param left - left border of the query
+     * @param right - right border of the query, inclusive
+     * @returns result of the query
+     */
+    T query(int left, int right) const{
+        return query(latest(), left, right);
+    }
+
+    /**
+     * @brief Get the latest version
+     */
+    int latest() const{
+        return (int) roots.size() - 1;
+    }
+
+    /**
+     * @brief Get the number of nodes in the pool of all versions
+     */
+    std::size_t nodes() const{
+        return pool.size();
+    }
+
+    /**
+     * @brief Get the memory used by the nodes in bytes
+     */
+    std::size_t memory() const{
+        return pool.size() * sizeof(Node) + roots.size() * sizeof(std::uint32_t);
+    }
+};
@@ -1,163 +1,13 @@
 /****************************************************************
  * @file
- * @brief Segment Tree Data Structure
- * @details
- * A segment tree is a tree data structure for storing and updating information
- * about intervals or segments
- *
- * ### Complexity
- * Build : O(n)
- * Update : O(log n)
- * Query : O(log n)
- * Space Complexity : O(4*n)
- * Where n is the size of the array
+ * @brief Segment Tree tests
 ****************************************************************/
 
+#include <algorithm>
 #include <iostream>
-#include <ostream>
+#include <random>
 #include <vector>
-
-template <typename T>
-class SegmentTree{
-    int size;
-    std::vector<T> tree;
-    T (*func)(T, T);  // function to use for range queries
-
-    // region Helper Functions
-
-    /**
-     * @brief Get the left child of a node
-     * @param index - index of the node
-     * @returns index of the left child
-     */
-    int get_left(int index){
-        return 2 * index + 1;
-    }
-
-    /**
-     * @brief Get the right child of a node
-     * @param index - index of the node
-     * @returns index of the right child
-     */
-    int get_right(int index){
-        return 2 * index + 2;
-    }
-
-    /**
-     * @brief Get the parent of a node
-     * @param index - index of the node
-     * @returns index of the parent
-     */
-    int get_parent(int index){
-        return (index - 1) / 2;
-    }
-
-    // endregion
-
-    /**
-     * @brief Build the segment tree
-     * @param arr - array to build the tree from
-     * @param node - current node
-     * @param left - left border of the array
-     * @param right - right border of the array
-     * @returns void
-     */
-    void build(const std::vector<T> &arr, int node, int left, int right){
-        if(left == right){
-            tree[node] = arr[left];
-            return;
-        }
-        int mid = (left + right) / 2;
-        build(arr, get_left(node), left, mid);
-        build(arr, get_right(node), mid + 1, right);
-        tree[node] = func(tree[get_left(node)], tree[get_right(node)]);
-    }
-
-    /**
-     * @brief Update the segment tree
-     * @param node - current node
-     * @param left - left border of the array
-     * @param right - right border of the array
-     * @param index - index to update
-     * @param value - value to update
-     * @returns void
-     */
-    void update(int node, int left, int right, int index, T value){
-        if(left == right){
-            tree[node] = value;
-            return;
-        }
-        int mid = (left + right) / 2;
-        if(index <= mid)
-            update(get_left(node), left, mid, index, value);
-        else
-            update(get_right(node), mid + 1, right, index, value);
-        tree[node] = func(tree[get_left(node)], tree[get_right(node)]);
-    }
-
-    /**
-     * @brief Query the segment tree
-     * @param node - current node
-     * @param left - left border of the array
-     * @param right - right border of the array
-     * @param query_left - left border of the query
-     * @param query_right - right border of the query
-     * @returns sum of the query
-     */
-    T query(int node, int left, int right, int query_left, int query_right){
-        if(query_left > right || query_right < left)
-            return 0;
-        if(query_left <= left && query_right >= right)
-            return tree[node];
-        int mid = (left + right) / 2;
-        T left_query = query(get_left(node), left, mid, query_left, query_right);
-        T right_query = query(get_right(node), mid + 1, right, query_left, query_right);
-        return func(left_query, right_query);
-    }
-
-public:
-    /**
-     * @brief Constructor
-     * @param arr - array to build the tree from
-     * @param f - function to use for range queries
-     */
-    SegmentTree(const std::vector<T> &arr, T (*func)(T, T)){
-        size = arr.size();
-        tree.resize(4 * size);
-        this->func = func;
-        build(arr, 0, 0, size - 1);
-    }
-
-    /**
-     * @brief Update the segment tree
-     * @param index - index to update
-     * @param value - value to update
-     * @returns void
-     */
-    void update(int index, T value){
-        update(0, 0, size - 1, index, value);
-    }
-
-    /**
-     * @brief Query the segment tree
-     * @param left - left border of the query
-     * @param right - right border of the query
-     * @returns sum of the query
-     */
-    T query(int left, int right){
-        return query(0, 0, size - 1, left, right);
-    }
-
-    /**
-     * @brief Output the segment tree
-     * @returns void
-     */
-     friend std::ostream &operator<<(std::ostream &os, const SegmentTree &segm_tree){
-        for(auto &i : segm_tree.tree)
-            os << i << " ";
-        return os;
-    }
-};
+#include "segment_tree.h"
 
 int main(){
     // region test 1
@@ -193,6 +43,54 @@ int main(){
     std::cout << tree3.query(0, 7) << ", correct answer: " << 100 << std::endl;
     std::cout << "Tree:" << std::endl;
     std::cout << tree3 << std::endl;
+    std::cout << std::endl;
+    // endregion
+
+    // region test 4
+    std::cout << "Test 4" << std::endl;
+    std::vector<int> arr4 = {3, 1, 4, 1, 5, 9, 2, 6};
+    SegmentTree<int> sum4(arr4, [](int a, int b){return a + b;});
+    SegmentTree<int> max4(arr4, [](int a, int b){return std::max(a, b);});
+    std::cout << "First prefix sum reaching 10: " << sum4.max_right(0, [](int s){return s < 10;})
+              << ", correct answer: " << 4 << std::endl;
+    std::cout << "First element greater than 4 from 2: " << max4.max_right(2, [](int m){return m <= 4;})
+              << ", correct answer: " << 4 << std::endl;
+    std::cout << "Last element greater than 4 up to 7: " << max4.min_left(7, [](int m){return m <= 4;})
+              << ", correct answer: " << 7 << std::endl;
+    std::cout << "Last element greater than 9 up to 7: " << max4.min_left(7, [](int m){return m <= 9;})
+              << ", correct answer: " << -1 << std::endl;
+    std::cout << std::endl;
+    // endregion
+
+    // region random test
+    std::mt19937 rng(42);
+    bool ok = true;
+    for(int n : {1, 2, 3, 10, 100, 1000}){
+        std::vector<int> arr(n);
+        for(auto &x : arr)
+            x = (int) (rng() % 100);
+        SegmentTree<int> sum_tree(arr, [](int a, int b){return a + b;});
+        for(int step = 0; step < 1000; step++){
+            int i = (int) (rng() % n), x = (int) (rng() % (50 * n));
+            auto pred = [x](int s){return s < x;};
+            int expected_right = i, s = 0;
+            while(expected_right < n && pred(s + arr[expected_right]))
+                s += arr[expected_right++];
+            int expected_left = i;
+            s = 0;
+            while(expected_left >= 0 && pred(s + arr[expected_left]))
+                s += arr[expected_left--];
+            ok = ok && sum_tree.max_right(i, pred) == expected_right && sum_tree.min_left(i, pred) == expected_left;
+            int index = (int) (rng() % n);
+            arr[index] = (int) (rng() % 100);
+            sum_tree.update(index, arr[index]);
+        }
+    }
+    std::cout << "Random test" << std::endl;
+    if(ok)
+        std::cout << "Random test passed" << std::endl;
+    else
+        std::cout << "Random test failed" << std::endl;
     // endregion
     return 0;
 }
@@ -0,0 +1,281 @@
+/****************************************************************
+ * @file
+ * @brief Segment Tree Data Structure
+ * @details
+ * A segment tree is a tree data structure for storing and updating information
+ * about intervals or segments
+ *
+ * max_right and min_left find where a monotone predicate of the range result
+ * stops holding, e.g. the first index where the prefix sum reaches x, in one
+ * descent of the tree instead of a binary search over query.
+ *
+ * ### Complexity
+ * Build : O(n)
+ * Update : O(log n)
+ * Query : O(log n)
+ * Max right, min left : O(log n)
+ * Space Complexity : O(4*n)
+ * Where n is the size of the array
+****************************************************************/
+
+#pragma once
+
+#include <ostream>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "snapshot_format.h"
+
+template <typename T>
+class SegmentTree{
+    int size;
+    std::vector<T> tree;
+    T (*func)(T, T);  // function to use for range queries
+
+    // region Helper Functions
+
+    /**
+     * @brief Get the left child of a node
+     * @param index - index of the node
+     * @returns index of the left child
+     */
+    int get_left(int index){
+        return 2 * index + 1;
+    }
+
+    /**
+     * @brief Get the right child of a node
+     * @param index - index of the node
+     * @returns index of the right child
+     */
+    int get_right(int index){
+        return 2 * index + 2;
+    }
+
+    /**
+     * @brief Get the parent of a node
+     * @param index - index of the node
+     * @returns index of the parent
+     */
+    int get_parent(int index){
+        return (index - 1) / 2;
+    }
+
+    // endregion
+
+    /**
+     * @brief Build the segment tree
+     * @param arr - array to build the tree from
+     * @param node - current node
+     * @param left - left border of the array
+     * @param right - right border of the array
+     * @returns void
+     */
+    void build(const std::vector<T> &arr, int node, int left, int right){
+        if(left == right){
+            tree[node] = arr[left];
+            return;
+        }
+        int mid = (left + right) / 2;
+        build(arr, get_left(node), left, mid);
+        build(arr, get_right(node), mid + 1, right);
+        tree[node] = func(tree[get_left(node)], tree[get_right(node)]);
+    }
+
+    /**
+     * @brief Update the segment tree
+     * @param node - current node
+     * @param left - left border of the array
+     * @param right - right border of the array
+     * @param index - index to update
+     * @param value - value to update
+     * @returns void
+     */
+    void update(int node, int left, int right, int index, T value){
+        if(left == right){
+            tree[node] = value;
+            return;
+        }
+        int mid = (left + right) / 2;
+        if(index <= mid)
+            update(get_left(node), left, mid, index, value);
+        else
+            update(get_right(node), mid + 1, right, index, value);
+        tree[node] = func(tree[get_left(node)], tree[get_right(node)]);
+    }
+
+    /**
+     * @brief Query the segment tree
+     * @param node - current node
+     * @param left - left border of the array
+     * @param right - right border of the array
+     * @param query_left - left border of the query
+     * @param query_right - right border of the query
+     * @returns sum of the query
+     */
+    T query(int node, int left, int right, int query_left, int query_right){
+        if(query_left > right || query_right < left)
+            return 0;
+        if(query_left <= left && query_right >= right)
+            return tree[node];
+        int mid = (left + right) / 2;
+        T left_query = query(get_left(node), left, mid, query_left, query_right);
+        T right_query = query(get_right(node), mid + 1, right, query_left, query_right);
+        return func(left_query, right_query);
+    }
+
+    /**
+     * @brief Descend to the first index from l where the predicate fails
+     * @param node - current node
+     * @param left - left border of the node
+     * @param right - right border of the node
+     * @param l - start of the range
+     * @param pred - predicate of the range result
+     * @param has_acc - true if acc holds the result of the range from l to left - 1
+     * @param acc - result of the range from l to left - 1
+     * @returns index where the predicate fails, -1 if it holds in the whole node
+     */
+    template <typename Pred>
+    int max_right(int node, int left, int right, int l, Pred &pred, bool &has_acc, T &acc){
+        if(right < l)
+            return -1;
+        if(left >= l){
+            T next = has_acc ? func(acc, tree[node]) : tree[node];
+            if(pred(next)){
+                acc = next;
+                has_acc = true;
+                return -1;
+            }
+            if(left == right)
+                return left;
+        }
+        int mid = (left + right) / 2;
+        int res = max_right(get_left(node), left, mid, l, pred, has_acc, acc);
+        if(res != -1)
+            return res;
+        return max_right(get_right(node), mid + 1, right, l, pred, has_acc, acc);
+    }
+
+    /**
+     * @brief Descend to the last index before r where the predicate fails
+     * @param node - current node
+     * @param left - left border of the node
+     * @param right - right border of the node
+     * @param r - end of the range
+     * @param pred - predicate of the range result
+     * @param has_acc - true if acc holds the result of the range from right + 1 to r
+     * @param acc - result of the range from right + 1 to r
+     * @returns index where the predicate fails, size if it holds in the whole node
+     */
+    template <typename Pred>
+    int min_left(int node, int left, int right, int r, Pred &pred, bool &has_acc, T &acc){
+        if(left > r)
+            return size;
+        if(right <= r){
+            T next = has_acc ? func(tree[node], acc) : tree[node];
+            if(pred(next)){
+                acc = next;
+                has_acc = true;
+                return size;
+            }
+            if(left == right)
+                return left;
+        }
+        int mid = (left + right) / 2;
+        int res = min_left(get_right(node), mid + 1, right, r, pred, has_acc, acc);
+        if(res != size)
+            return res;
+        return min_left(get_left(node), left, mid, r, pred, has_acc, acc);
+    }
+
+public:
+    /**
+     * @brief Constructor
+     * @param arr - array to build the tree from
+     * @param f - function to use for range queries
+     */
+    SegmentTree(const std::vector<T> &arr, T (*func)(T, T)){
+        size = arr.size();
+        tree.resize(4 * size);
+        this->func = func;
+        build(arr, 0, 0, size - 1);
+    }
+
+    /**
+     * @brief Update the segment tree
+     * @param index - index to update
+     * @param value - value to update
+     * @returns void
+     */
+    void update(int index, T value){
+        update(0, 0, size - 1, index, value);
+    }
+
+    /**
+     * @brief Query the segment tree
+     * @param left - left border of the query
+     * @param right - right border of the query
+     * @returns sum of the query
+     */
+    T query(int left, int right){
+        return query(0, 0, size - 1, left, right);
+    }
+
+    /**
+     * @brief Find where a predicate of the range result starting at l stops holding
+     * @details pred must be monotone: if it fails on query(l, r), it fails for larger r
+     * @param l - left border of the range
+     * @param pred - predicate of the range result
+     * @returns the first r >= l such that pred(query(l, r)) is false, size if there is none
+     */
+    template <typename Pred>
+    int max_right(int l, Pred pred){
+        if(l >= size)
+            return size;
+        if(l < 0)
+            l = 0;
+        bool has_acc = false;
+        T acc{};
+        int res = max_right(0, 0, size - 1, l, pred, has_acc, acc);
+        return res == -1 ? size : res;
+    }
+
+    /**
+     * @brief Find where a predicate of the range result ending at r stops holding
+     * @details pred must be monotone: if it fails on query(l, r), it fails for smaller l
+     * @param r - right border of the range
+     * @param pred - predicate of the range result
+     * @returns the last l <= r such that pred(query(l, r)) is false, -1 if there is none
+     */
+    template <typename Pred>
+    int min_left(int r, Pred pred){
+        if(r < 0)
+            return -1;
+        if(r >= size)
+            r = size - 1;
+        bool has_acc = false;
+        T acc{};
+        int res = min_left(0, 0, size - 1, r, pred, has_acc, acc);
+        return res == size ? -1 : res;
+    }
+
+    /**
+     * @brief Save the tree to a snapshot file, SegmentTreeView maps it back
+     * @param path - file to write, replaced if it exists
+     */
+    void save(const std::string &path) const{
+        static_assert(std::is_trivially_copyable_v<T>, "Snapshots need a trivially copyable T");
+        snapshot_detail::write<T>(path, snapshot_detail::Kind::SegmentTree, size, 0,
+                                  {{tree.data(), tree.size() * sizeof(T)}});
+    }
+
+    /**
+     * @brief Output the segment tree
+     * @returns void
+     */
+     friend std::ostream &operator<<(std::ostream &os, const SegmentTree &segm_tree){
+        for(auto &i : segm_tree.tree)
+            os << i << " ";
+        return os;
+    }
+};
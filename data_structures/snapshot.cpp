@@ -0,0 +1,165 @@
+/****************************************************************
+ * @file
+ * @brief Snapshot tests
+****************************************************************/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include "dsu.h"
+#include "segment_tree.h"
+#include "snapshot.h"
+#include "sparse_table.h"
+
+int main(){
+    std::filesystem::path dir = std::filesystem::temp_directory_path() / "snapshot_test";
+    std::filesystem::create_directories(dir);
+    auto sum = [](long long a, long long b){return a + b;};
+    auto min = [](int a, int b){return std::min(a, b);};
+
+    // region test 1
+    std::cout << "Test 1" << std::endl;
+    std::vector<long long> arr1 = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    SegmentTree<long long> tree1(arr1, sum);
+    tree1.update(0, 11);
+    tree1.save(dir / "tree1.snap");
+    SegmentTreeView<long long> view1(dir / "tree1.snap", sum);
+    std::cout << view1.query(0, 9) << ", correct answer: " << 65 << std::endl;
+    std::cout << view1.query(2, 4) << ", correct answer: " << 12 << std::endl;
+
+    std::vector<int> arr2 = {5, 3, 8, 1, 9, 2};
+    SparseTable<int> table2(arr2, min);
+    table2.save(dir / "table2.snap");
+    SparseTableView<int> view2(dir / "table2.snap", min);
+    std::cout << view2.query(0, 2) << ", correct answer: " << 3 << std::endl;
+    std::cout << view2.query(4, 5) << ", correct answer: " << 2 << std::endl;
+
+    DSU<int> dsu3(5);
+    dsu3.union_sets(0, 1);
+    dsu3.union_sets(3, 4);
+    dsu3.union_sets(1, 4);
+    dsu3.save(dir / "dsu3.snap");
+    DSUView<int> view3(dir / "dsu3.snap");
+    std::cout << view3.same_set(0, 3) << ", correct answer: " << 1 << std::endl;
+    std::cout << view3.same_set(0, 2) << ", correct answer: " << 0 << std::endl;
+    std::cout << std::endl;
+    // endregion
+
+    // region test 2
+    std::cout << "Test 2" << std::endl;
+    try{
+        SparseTableView<long long> wrong(dir / "table2.snap", sum);
+        std::cout << "No error, correct answer: error" << std::endl;
+    }catch(const std::runtime_error &e){
+        std::cout << e.what() << ", correct answer: Snapshot holds another value type" << std::endl;
+    }
+    // same size, another kind of number
+    try{
+        SparseTableView<float> wrong(dir / "table2.snap", [](float a, float b){return std::min(a, b);});
+        std::cout << "No error, correct answer: error" << std::endl;
+    }catch(const std::runtime_error &e){
+        std::cout << e.what() << ", correct answer: Snapshot holds another value type" << std::endl;
+    }
+    try{
+        DSUView<int> wrong(dir / "table2.snap");
+        std::cout << "No error, correct answer: error" << std::endl;
+    }catch(const std::runtime_error &e){
+        std::cout << e.what() << ", correct answer: Snapshot holds another structure" << std::endl;
+    }
+    // a size that does not fit the int indices of the views, its low 32 bits match the arrays
+    {
+        std::vector<char> bytes(std::filesystem::file_size(dir / "table2.snap"));
+        std::ifstream(dir / "table2.snap", std::ios::binary).read(bytes.data(), (std::streamsize) bytes.size());
+        snapshot_detail::Header header;
+        std::memcpy(&header, bytes.data(), sizeof(header));
+        header.size += std::uint64_t(1) << 32;
+        std::memcpy(bytes.data(), &header, sizeof(header));
+        std::ofstream(dir / "huge.snap", std::ios::binary).write(bytes.data(), (std::streamsize) bytes.size());
+    }
+    try{
+        SparseTableView<int> wrong(dir / "huge.snap", min);
+        std::cout << "No error, correct answer: error" << std::endl;
+    }catch(const std::runtime_error &e){
+        std::cout << e.what() << ", correct answer: Snapshot is corrupted" << std::endl;
+    }
+    // arguments outside the mapped arrays
+    try{
+        view2.query(4, 6);
+        std::cout << "No error, correct answer: error" << std::endl;
+    }catch(const std::runtime_error &e){
+        std::cout << e.what() << ", correct answer: Invalid range" << std::endl;
+    }
+    try{
+        view3.same_set(0, 5);
+        std::cout << "No error, correct answer: error" << std::endl;
+    }catch(const std::runtime_error &e){
+        std::cout << e.what() << ", correct answer: Invalid element" << std::endl;
+    }
+    try{
+        view3.find_set(-1);
+        std::cout << "No error, correct answer: error" << std::endl;
+    }catch(const std::runtime_error &e){
+        std::cout << e.what() << ", correct answer: Invalid element" << std::endl;
+    }
+    std::cout << std::endl;
+    // endregion
+
+    // region random test
+    std::mt19937 rng(42);
+    bool ok = true;
+    for(int n : {1, 2, 3, 17, 1000}){
+        std::vector<long long> values(n);
+        std::vector<int> ints(n);
+        for(int i = 0; i < n; i++)
+            ints[i] = (int) (values[i] = rng() % 1000);
+        SegmentTree<long long> tree(values, sum);
+        SparseTable<int> table(ints, min);
+        DSU<int> dsu(n);
+        for(int i = 0; i < n / 2; i++)
+            dsu.union_sets((int) (rng() % n), (int) (rng() % n));
+        tree.save(dir / "tree.snap");
+        table.save(dir / "table.snap");
+        dsu.save(dir / "dsu.snap");
+        SegmentTreeView<long long> tree_view(dir / "tree.snap", sum);
+        SparseTableView<int> table_view(dir / "table.snap", min);
+        DSUView<int> dsu_view(dir / "dsu.snap");
+        for(int step = 0; step < 500; step++){
+            int l = (int) (rng() % n), r = (int) (rng() % n);
+            if(l > r)
+                std::swap(l, r);
+            ok = ok && tree_view.query(l, r) == tree.query(l, r) && table_view.query(l, r) == table.query(l, r)
+                 && dsu_view.same_set(l, r) == dsu.same_set(l, r);
+        }
+    }
+    std::cout << "Random test " << (ok ? "passed" : "failed") << std::endl;
+    std::cout << std::endl;
+    // endregion
+
+    // region cold start
+    std::vector<int> arr(1 << 22);
+    for(auto &x : arr)
+        x = (int) rng();
+    auto start = std::chrono::steady_clock::now();
+    SparseTable<int> table(arr, min);
+    auto built = std::chrono::steady_clock::now();
+    table.save(dir / "table.snap");
+    auto saved = std::chrono::steady_clock::now();
+    SparseTableView<int> view(dir / "table.snap", min);
+    int first = view.query(0, (int) arr.size() - 1);
+    auto mapped = std::chrono::steady_clock::now();
+    auto ms = [](auto d){return std::chrono::duration<double, std::milli>(d).count();};
+    std::cout << "SparseTable of " << arr.size() << " ints: build " << ms(built - start) << " ms, save "
+              << ms(saved - built) << " ms, map and first query " << ms(mapped - saved) << " ms"
+              << (first == table.query(0, (int) arr.size() - 1) ? "" : ", wrong result") << std::endl;
+    // endregion
+
+    std::filesystem::remove_all(dir);
+    return 0;
+}
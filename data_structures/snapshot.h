@@ -0,0 +1,282 @@
+/****************************************************************
+ * @file
+ * @brief Binary Snapshots of Data Structures
+ * @details
+ * Views of the snapshots written by save(path) of SegmentTree, SparseTable
+ * and DSU, the format is described in snapshot_format.h. A view maps the
+ * file with mmap and answers queries directly on the mapped buffer, nothing
+ * is copied or parsed, so opening costs the page faults of the pages a
+ * query touches.
+ *
+ * A view checks the header and throws std::runtime_error on a mismatch, a
+ * file from a machine with another byte order is rejected. Queries check
+ * their arguments, so a bad one does not read past the mapping.
+ *
+ * Views are read-only and need POSIX mmap, they are only defined where
+ * <sys/mman.h> exists (SNAPSHOT_VIEWS).
+****************************************************************/
+
+#pragma once
+
+#include <bit>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "snapshot_format.h"
+
+#if __has_include(<sys/mman.h>)
+#define SNAPSHOT_VIEWS 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef SNAPSHOT_VIEWS
+namespace snapshot_detail{
+    /**
+     * @brief Read-only memory mapping of a whole file
+     */
+    class MappedFile{
+        void *data = nullptr;
+        std::size_t bytes = 0;
+
+    public:
+        explicit MappedFile(const std::string &path){
+            int fd = open(path.c_str(), O_RDONLY);
+            if(fd == -1)
+                throw std::runtime_error("Cannot open file " + path);
+            struct stat st{};
+            if(fstat(fd, &st) == -1){
+                close(fd);
+                throw std::runtime_error("Cannot stat file " + path);
+            }
+            bytes = (std::size_t) st.st_size;
+            if(bytes > 0)
+                data = mmap(nullptr, bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+            close(fd);  // the mapping keeps the file
+            if(data == MAP_FAILED){
+                data = nullptr;
+                throw std::runtime_error("Cannot map file " + path);
+            }
+        }
+
+        MappedFile(MappedFile &&other) noexcept
+                : data(std::exchange(other.data, nullptr)), bytes(std::exchange(other.bytes, 0)){}
+
+        MappedFile &operator=(MappedFile &&other) noexcept{
+            std::swap(data, other.data);
+            std::swap(bytes, other.bytes);
+            return *this;
+        }
+
+        MappedFile(const MappedFile &) = delete;
+        MappedFile &operator=(const MappedFile &) = delete;
+
+        ~MappedFile(){
+            if(data)
+                munmap(data, bytes);
+        }
+
+        /**
+         * @brief Check the header of a snapshot of a structure of T
+         * @returns the header, the arrays follow it
+         */
+        template <typename T>
+        const Header &header(Kind kind) const{
+            if(bytes < sizeof(Header))
+                throw std::runtime_error("Snapshot is truncated");
+            const Header &h = *static_cast<const Header *>(data);
+            if(std::memcmp(h.magic, MAGIC, sizeof(MAGIC)) != 0)
+                throw std::runtime_error("File is not a snapshot");
+            if(h.endian != ENDIAN_TAG)
+                throw std::runtime_error("Snapshot has another byte order");
+            if(h.version != VERSION)
+                throw std::runtime_error("Unsupported snapshot version " + std::to_string(h.version));
+            if(h.kind != (std::uint32_t) kind)
+                throw std::runtime_error("Snapshot holds another structure");
+            if(h.value_size != sizeof(T) || h.type != type_tag<T>())
+                throw std::runtime_error("Snapshot holds another value type");
+            if(h.size > INT_MAX)  // views index with int
+                throw std::runtime_error("Snapshot is corrupted");
+            if(bytes - sizeof(Header) < h.payload)
+                throw std::runtime_error("Snapshot is truncated");
+            return h;
+        }
+
+        /**
+         * @brief Get the arrays after the header
+         */
+        template <typename T>
+        const T *payload() const{
+            return reinterpret_cast<const T *>(static_cast<const char *>(data) + sizeof(Header));
+        }
+    };
+}
+
+template <typename T>
+class SegmentTreeView{
+    static_assert(std::is_trivially_copyable_v<T>, "Snapshots need a trivially copyable T");
+
+    snapshot_detail::MappedFile file;
+    const T *tree;
+    int size;
+    T (*func)(T, T);  // function the tree was built with
+
+    /**
+     * @brief Query a subtree
+     * @param node - current node
+     * @param left - left border of the node
+     * @param right - right border of the node
+     * @param query_left - left border of the query, inside the node
+     * @param query_right - right border of the query, inside the node
+     * @returns result of the query
+     */
+    T query(int node, int left, int right, int query_left, int query_right) const{
+        while(query_left != left || query_right != right){
+            int mid = (left + right) / 2;
+            if(query_right <= mid){
+                node = 2 * node + 1;
+                right = mid;
+            }else if(query_left > mid){
+                node = 2 * node + 2;
+                left = mid + 1;
+            }else{
+                return func(query(2 * node + 1, left, mid, query_left, mid),
+                            query(2 * node + 2, mid + 1, right, mid + 1, query_right));
+            }
+        }
+        return tree[node];
+    }
+
+public:
+    /**
+     * @brief Map a snapshot saved by SegmentTree::save
+     * @param path - snapshot file
+     * @param func - function the tree was built with
+     */
+    SegmentTreeView(const std::string &path, T (*func)(T, T)) : file(path), func(func){
+        const snapshot_detail::Header &header = file.header<T>(snapshot_detail::Kind::SegmentTree);
+        if(header.payload != 4 * header.size * sizeof(T))
+            throw std::runtime_error("Snapshot is corrupted");
+        size = (int) header.size;
+        tree = file.payload<T>();
+    }
+
+    /**
+     * @brief Query the segment tree
+     * @param left - left border of the query
+     * @param right - right border of the query, inclusive
+     * @returns result of the query
+     */
+    T query(int left, int right) const{
+        if(left < 0 || right >= size || left > right)
+            throw std::runtime_error("Invalid range");
+        return query(0, 0, size - 1, left, right);
+    }
+};
+
+template <typename T>
+class SparseTableView{
+    static_assert(std::is_trivially_copyable_v<T>, "Snapshots need a trivially copyable T");
+
+    snapshot_detail::MappedFile file;
+    std::vector<const T *> levels;  // levels[j][i] is the result of [i, i + 2^j)
+    int n;  // size of input array
+    T (*func)(T, T);  // function the table was built with
+
+public:
+    /**
+     * @brief Map a snapshot saved by SparseTable::save
+     * @param path - snapshot file
+     * @param f - function the table was built with
+     */
+    SparseTableView(const std::string &path, T (*f)(T, T)) : file(path), func(f){
+        const snapshot_detail::Header &header = file.header<T>(snapshot_detail::Kind::SparseTable);
+        n = (int) header.size;
+        if(header.levels != (std::uint64_t) std::bit_width((unsigned) n))
+            throw std::runtime_error("Snapshot is corrupted");
+        std::size_t offset = 0;
+        for(int j = 0; j < (int) header.levels; j++){
+            levels.push_back(file.payload<T>() + offset);
+            offset += n - (1 << j) + 1;
+        }
+        if(header.payload != offset * sizeof(T))
+            throw std::runtime_error("Snapshot is corrupted");
+    }
+
+    /**
+     * @brief Range Query
+     * @param l - left border of range
+     * @param r - right border of range
+     * @return result of range query
+     */
+    T query(int l, int r) const{
+        if(l < 0 || r >= n || l > r)
+            throw std::runtime_error("Invalid range");
+        int j = std::bit_width((unsigned) (r - l + 1)) - 1;
+        return func(levels[j][l], levels[j][r - (1 << j) + 1]);
+    }
+};
+
+template <typename T>
+class DSUView{
+    static_assert(std::is_trivially_copyable_v<T>, "Snapshots need a trivially copyable T");
+
+    snapshot_detail::MappedFile file;
+    const T *representative;  // representative[i] is the representative of the set of i
+    int n;  // number of elements in the set
+
+    /**
+     * @brief Check that i is an element of the set
+     */
+    void check(T i) const{
+        if((std::uint64_t) i >= (std::uint64_t) n)  // negative i wraps around
+            throw std::runtime_error("Invalid element");
+    }
+
+public:
+    /**
+     * @brief Map a snapshot saved by DSU::save
+     * @param path - snapshot file
+     */
+    explicit DSUView(const std::string &path) : file(path){
+        const snapshot_detail::Header &header = file.header<T>(snapshot_detail::Kind::DSU);
+        if(header.payload != header.size * sizeof(T))
+            throw std::runtime_error("Snapshot is corrupted");
+        n = (int) header.size;
+        representative = file.payload<T>();
+    }
+
+    /**
+     * @brief Find the set that i is an element of
+     * @returns representative of the set that i is an element of
+     */
+    T find_set(T i) const{
+        check(i);
+        return representative[i];
+    }
+
+    /**
+     * @brief Check if two elements are in the same set
+     */
+    bool same_set(T i, T j) const{
+        check(i);
+        check(j);
+        return representative[i] == representative[j];
+    }
+
+    /**
+     * @brief Get the number of elements
+     */
+    int size() const{
+        return n;
+    }
+};
+#endif
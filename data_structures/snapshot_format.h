@@ -0,0 +1,114 @@
+/****************************************************************
+ * @file
+ * @brief Binary Snapshot Format
+ * @details
+ * SegmentTree, SparseTable and DSU of trivially copyable T can be saved to
+ * a file with save(path), the views of snapshot.h map it back. Writing
+ * needs only the standard library.
+ *
+ * Format, version 2: a 64-byte header followed by the arrays of the
+ * structure in the byte order of the machine that saved them.
+ * - magic "ALGOSNAP", format version, endian tag 0x01020304 as written by
+ * the saving machine, kind of structure, sizeof(T)
+ * - size, number of levels, bytes of the arrays
+ * - type tag of T: integral, floating point and signed bits, so int and
+ * float of the same size do not match. Other types have tag 0 and are only
+ * told apart by their size. Version 1 had no tag.
+ *
+ * Arrays:
+ * - SegmentTree: the 4n nodes as they are in memory
+ * - SparseTable: the levels one after another, level j has n - 2^j + 1 values
+ * - DSU: the representative of every element, so find_set is one load
+****************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace snapshot_detail{
+    constexpr char MAGIC[8] = {'A', 'L', 'G', 'O', 'S', 'N', 'A', 'P'};
+    constexpr std::uint32_t VERSION = 2;
+    constexpr std::uint32_t ENDIAN_TAG = 0x01020304;
+
+    enum class Kind : std::uint32_t{
+        SegmentTree = 1,
+        SparseTable = 2,
+        DSU = 3
+    };
+
+    enum TypeFlags : std::uint32_t{
+        INTEGRAL = 1,
+        FLOATING = 2,
+        SIGNED = 4
+    };
+
+    /**
+     * @brief Get the type tag of T, 0 for types that are not arithmetic
+     */
+    template <typename T>
+    constexpr std::uint32_t type_tag(){
+        return (std::is_integral_v<T> ? INTEGRAL : 0) | (std::is_floating_point_v<T> ? FLOATING : 0)
+               | (std::is_signed_v<T> ? SIGNED : 0);
+    }
+
+    struct Header{
+        char magic[8];
+        std::uint32_t version;
+        std::uint32_t endian;  // ENDIAN_TAG in the byte order of the saving machine
+        std::uint32_t kind;
+        std::uint32_t value_size;  // sizeof(T)
+        std::uint64_t size;  // number of elements of the structure
+        std::uint64_t levels;  // number of levels of a sparse table, 0 otherwise
+        std::uint64_t payload;  // bytes of the arrays after the header
+        std::uint32_t type;  // type_tag<T>()
+        char reserved[12];  // keeps the arrays 64-byte aligned
+    };
+    static_assert(sizeof(Header) == 64, "Header must keep the arrays aligned");
+
+    /**
+     * @brief One array of a snapshot
+     */
+    struct Part{
+        const void *data;
+        std::size_t bytes;
+    };
+
+    /**
+     * @brief Write a snapshot of a structure of T
+     * @param path - file to write, replaced if it exists
+     * @param kind - kind of structure
+     * @param size - number of elements of the structure
+     * @param levels - number of levels of a sparse table, 0 otherwise
+     * @param parts - arrays of the structure in order
+     */
+    template <typename T>
+    void write(const std::string &path, Kind kind, std::size_t size, std::size_t levels,
+               const std::vector<Part> &parts){
+        Header header{};
+        std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+        header.version = VERSION;
+        header.endian = ENDIAN_TAG;
+        header.kind = (std::uint32_t) kind;
+        header.value_size = sizeof(T);
+        header.type = type_tag<T>();
+        header.size = size;
+        header.levels = levels;
+        for(auto &part : parts)
+            header.payload += part.bytes;
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if(!file)
+            throw std::runtime_error("Cannot open file " + path);
+        file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        for(auto &part : parts)
+            file.write(static_cast<const char *>(part.data), (std::streamsize) part.bytes);
+        if(!file.flush())
+            throw std::runtime_error("Cannot write file " + path);
+    }
+}
@@ -0,0 +1,131 @@
+/****************************************************************
+ * @file
+ * @brief Sparse Table Data Structure
+ * @details
+ * Sparse Table is a data structure, that allows answering range queries.
+ * Operation: find maximum or minimum element in a subsection of elements in O(1)
+ *
+ * If any element in the array changes, the whole array is rebuilt.
+ *
+ * ### Complexity
+ *
+ * Build : O(n*logn)
+ * Range Query : O(1)
+ * Update : O(n*logn)
+ * Space Complexity : O(n*logn)
+****************************************************************/
+
+#pragma once
+
+#include <iostream>
+#include <vector>
+#include <cmath>
+#include <string>
+#include <type_traits>
+#include "snapshot_format.h"
+
+template <typename T>
+class SparseTable{
+    std::vector<std::vector<T>> table;
+    std::vector<int> logs;
+    int n;  // size of input array
+    T (*func)(T, T);  // function to use for range queries
+
+    /**
+     * @brief Fills the table with the values of the input array
+     * @param arr
+     */
+    void build(std::vector<T> &arr){
+        for(int i = 0; i < n; i++)
+            table[i][0] = arr[i];
+        for(int j = 1; (1 << j) <= n; j++)
+            for(int i = 0; i + (1 << j) <= n; i++)
+                table[i][j] = func(table[i][j - 1], table[i + (1 << (j - 1))][j - 1]);
+    }
+
+    /**
+     * @brief Fills the logs array with the values of log2(i)
+     */
+    void build_logs(){
+        logs[1] = 0;
+        for(int i = 2; i <= n; i++)
+            logs[i] = logs[i / 2] + 1;
+    }
+
+public:
+    /**
+     * @brief Constructor
+     * @param arr - input array
+     * @param f - function to use for range queries
+     */
+    SparseTable(std::vector<T> &arr, T (*f)(T, T)){
+        n = arr.size();
+        func = f;
+        table.resize(n, std::vector<T>(log2(n) + 1));
+        logs.resize(n + 1);
+        build_logs();
+        build(arr);
+    }
+
+    /**
+     * @brief Range Query
+     * @param l - left border of range
+     * @param r - right border of range
+     * @return result of range query
+     */
+    T query(int l, int r){
+        int j = logs[r - l + 1];
+        return func(table[l][j], table[r - (1 << j) + 1][j]);
+    }
+
+    /**
+     * @brief Updates the value at index idx to val
+     * @param idx - index to update
+     * @param val - new value
+     */
+    void update(int idx, T val){
+        table[idx][0] = val;
+        for(int j = 1; (1 << j) <= n; j++)
+            table[idx][j] = func(table[idx][j - 1], table[idx + (1 << (j - 1))][j - 1]);
+    }
+
+    /**
+     * @brief Save the table to a snapshot file, SparseTableView maps it back
+     * @param path - file to write, replaced if it exists
+     */
+    void save(const std::string &path) const{
+        static_assert(std::is_trivially_copyable_v<T>, "Snapshots need a trivially copyable T");
+        // the rows of the table are the columns of the file, rows are read in order
+        std::vector<std::vector<T>> levels;
+        for(int j = 0; (1 << j) <= n; j++)
+            levels.emplace_back(n - (1 << j) + 1);
+        for(int i = 0; i < n; i++)
+            for(int j = 0; i + (1 << j) <= n; j++)
+                levels[j][i] = table[i][j];
+        std::vector<snapshot_detail::Part> parts;
+        for(auto &level : levels)
+            parts.push_back({level.data(), level.size() * sizeof(T)});
+        snapshot_detail::write<T>(path, snapshot_detail::Kind::SparseTable, n, levels.size(), parts);
+    }
+
+    /**
+     * @brief Get the memory used by the table in bytes
+     */
+    std::size_t memory() const{
+        std::size_t res = logs.size() * sizeof(int);
+        for(auto &row : table)
+            res += sizeof(row) + row.size() * sizeof(T);
+        return res;
+    }
+
+    /**
+     * @brief Prints the table
+     */
+    void print(){
+        for(int i = 0; i < n; i++){
+            for(int j = 0; j <= log2(n); j++)
+                std::cout << table[i][j] << " ";
+            std::cout << std::endl;
+        }
+    }
+};
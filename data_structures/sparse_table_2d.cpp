@@ -0,0 +1,80 @@
+/****************************************************************
+ * @file
+ * @brief 2D Sparse Table tests
+****************************************************************/
+
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include "sparse_table_2d.h"
+
+int main(){
+    // region test 1
+    std::cout << "Test 1" << std::endl;
+    std::vector<std::vector<int>> grid1 = {{5, 3, 8, 1},
+                                           {2, 9, 4, 7},
+                                           {6, 0, 3, 5}};
+    SparseTable2D<int> table1(grid1, [](int a, int b){return std::max(a, b);});
+    std::cout << table1.query(0, 0, 2, 3) << ", correct answer: " << 9 << std::endl;
+    std::cout << table1.query(1, 2, 2, 3) << ", correct answer: " << 7 << std::endl;
+    std::cout << table1.query(2, 0, 2, 2) << ", correct answer: " << 6 << std::endl;
+    std::cout << std::endl;
+    // endregion
+
+    // region test 2
+    std::cout << "Test 2" << std::endl;
+    SparseTable2D<int> table2(grid1, [](int a, int b){return std::min(a, b);}, true);
+    std::cout << table2.query(0, 0, 2, 3) << ", correct answer: " << 0 << std::endl;
+    std::cout << table2.query(0, 0, 1, 1) << ", correct answer: " << 2 << std::endl;
+    std::cout << table2.query(0, 2, 1, 3) << ", correct answer: " << 1 << std::endl;
+    try{
+        SparseTable2D<int> ragged({{1, 2, 3}, {4, 5}}, [](int a, int b){return std::min(a, b);});
+        std::cout << "No error, correct answer: error" << std::endl;
+    }catch(const std::runtime_error &e){
+        std::cout << e.what() << ", correct answer: Rows have different lengths" << std::endl;
+    }
+    std::cout << std::endl;
+    // endregion
+
+    // region random test
+    std::mt19937 rng(42);
+    bool ok = true;
+    for(auto [rows, cols] : {std::pair{1, 1}, {1, 17}, {17, 1}, {5, 40}, {40, 5}, {33, 64}, {100, 100}}){
+        std::vector<std::vector<int>> grid(rows, std::vector<int>(cols));
+        for(auto &row : grid)
+            for(auto &x : row)
+                x = (int) (rng() % 1000);
+        SparseTable2D<int> full(grid, [](int a, int b){return std::max(a, b);});
+        SparseTable2D<int> squares(grid, [](int a, int b){return std::max(a, b);}, true);
+        for(int step = 0; step < 500; step++){
+            int r1 = (int) (rng() % rows), r2 = (int) (rng() % rows);
+            int c1 = (int) (rng() % cols), c2 = (int) (rng() % cols);
+            if(r1 > r2)
+                std::swap(r1, r2);
+            if(c1 > c2)
+                std::swap(c1, c2);
+            int expected = grid[r1][c1];
+            for(int r = r1; r <= r2; r++)
+                for(int c = c1; c <= c2; c++)
+                    expected = std::max(expected, grid[r][c]);
+            ok = ok && full.query(r1, c1, r2, c2) == expected && squares.query(r1, c1, r2, c2) == expected;
+        }
+    }
+    std::cout << "Random test " << (ok ? "passed" : "failed") << std::endl;
+    std::cout << std::endl;
+    // endregion
+
+    // region memory
+    std::vector<std::vector<int>> grid(1000, std::vector<int>(1000));
+    for(auto &row : grid)
+        for(auto &x : row)
+            x = (int) rng();
+    SparseTable2D<int> full(grid, [](int a, int b){return std::max(a, b);});
+    SparseTable2D<int> squares(grid, [](int a, int b){return std::max(a, b);}, true);
+    std::cout << "Memory of a 1000 x 1000 grid of ints: " << full.memory() / (1 << 20) << " MiB, "
+              << squares.memory() / (1 << 20) << " MiB with squares only" << std::endl;
+    // endregion
+    return 0;
+}
@@ -0,0 +1,186 @@
+/****************************************************************
+ * @file
+ * @brief 2D Sparse Table Data Structure
+ * @details
+ * Range minimum or maximum queries over rectangles of a static grid. Level
+ * (a, b) keeps the result of every 2^a x 2^b rectangle, and a query covers its
+ * rectangle with four overlapping rectangles of one level, so func must be
+ * idempotent, e.g. min, max, gcd.
+ *
+ * All levels live in one contiguous array in level-major order, each level
+ * is row-major and only has the positions where its rectangle fits.
+ *
+ * With square_only, only the levels of 2^k x 2^k squares are kept. Memory
+ * drops from log(rows) * log(cols) to log(min(rows, cols)) grids, and a query
+ * covers its rectangle with squares of the shorter side: it does
+ * 2 * ceil(long side / short side) lookups, 4 for near-square rectangles.
+ *
+ * ### Complexity
+ *
+ * Build : O(n*m*logn*logm), O(n*m*log(min(n, m))) with square_only
+ * Range Query : O(1), O(max(h, w) / min(h, w)) with square_only
+ * Space Complexity : O(n*m*logn*logm), O(n*m*log(min(n, m))) with square_only
+ * Where h x w is the size of the rectangle of a query
+****************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <stdexcept>
+#include <vector>
+
+template <typename T>
+class SparseTable2D{
+    std::vector<T> table;  // all levels, level-major, each level row-major
+    std::vector<std::size_t> offsets;  // offsets[level] is the start of a level in table
+    int rows, cols;  // size of the grid
+    int row_levels, col_levels;  // number of levels along rows and columns
+    bool square_only;  // only levels of squares are kept
+    T (*func)(T, T);  // function to use for range queries
+
+    /**
+     * @brief Get the index of a level
+     * @param a - log2 of the height of the rectangles
+     * @param b - log2 of the width of the rectangles, equal to a if square_only
+     */
+    int level(int a, int b) const{
+        return square_only ? a : a * col_levels + b;
+    }
+
+    /**
+     * @brief Get the result of a rectangle of a level
+     * @param a - log2 of the height of the rectangle
+     * @param b - log2 of the width of the rectangle
+     * @param r - top row
+     * @param c - left column
+     */
+    T &at(int a, int b, int r, int c){
+        return table[offsets[level(a, b)] + (std::size_t) r * (cols - (1 << b) + 1) + c];
+    }
+
+    const T &at(int a, int b, int r, int c) const{
+        return table[offsets[level(a, b)] + (std::size_t) r * (cols - (1 << b) + 1) + c];
+    }
+
+    /**
+     * @brief Reserve all levels
+     */
+    void allocate(){
+        std::size_t total = 0;
+        for(int a = 0; a < row_levels; a++)
+            for(int b = 0; b < col_levels; b++){
+                if(square_only && a != b)
+                    continue;
+                offsets[level(a, b)] = total;
+                total += (std::size_t) (rows - (1 << a) + 1) * (cols - (1 << b) + 1);
+            }
+        table.resize(total);
+    }
+
+    /**
+     * @brief Fills the levels of rectangles
+     */
+    void build_rectangles(){
+        for(int a = 0; a < row_levels; a++)
+            for(int b = 0; b < col_levels; b++){
+                if(a == 0 && b == 0)
+                    continue;
+                for(int r = 0; r + (1 << a) <= rows; r++)
+                    for(int c = 0; c + (1 << b) <= cols; c++)
+                        // halve the height, the first row of levels halves the width
+                        at(a, b, r, c) = a ? func(at(a - 1, b, r, c), at(a - 1, b, r + (1 << (a - 1)), c))
+                                           : func(at(a, b - 1, r, c), at(a, b - 1, r, c + (1 << (b - 1))));
+            }
+    }
+
+    /**
+     * @brief Fills the levels of squares
+     */
+    void build_squares(){
+        for(int k = 1; k < row_levels; k++){
+            int half = 1 << (k - 1);
+            for(int r = 0; r + (1 << k) <= rows; r++)
+                for(int c = 0; c + (1 << k) <= cols; c++)
+                    at(k, k, r, c) = func(func(at(k - 1, k - 1, r, c), at(k - 1, k - 1, r, c + half)),
+                                          func(at(k - 1, k - 1, r + half, c), at(k - 1, k - 1, r + half, c + half)));
+        }
+    }
+
+    /**
+     * @brief Range Query with squares
+     * @details the rectangle is covered by squares of its shorter side along the longer side,
+     * the last one is aligned to the end
+     */
+    T query_squares(int r1, int c1, int r2, int c2) const{
+        int height = r2 - r1 + 1, width = c2 - c1 + 1;
+        int k = std::bit_width((unsigned) std::min(height, width)) - 1;
+        int side = 1 << k;
+        int bottom = r2 - side + 1, right = c2 - side + 1;
+        if(height <= width){
+            T res = func(at(k, k, r1, c1), at(k, k, bottom, c1));
+            for(int c = c1 + side; c < right; c += side)
+                res = func(res, func(at(k, k, r1, c), at(k, k, bottom, c)));
+            return func(res, func(at(k, k, r1, right), at(k, k, bottom, right)));
+        }
+        T res = func(at(k, k, r1, c1), at(k, k, r1, right));
+        for(int r = r1 + side; r < bottom; r += side)
+            res = func(res, func(at(k, k, r, c1), at(k, k, r, right)));
+        return func(res, func(at(k, k, bottom, c1), at(k, k, bottom, right)));
+    }
+
+public:
+    /**
+     * @brief Constructor
+     * @param grid - input grid, not empty, all rows of the same length
+     * @param f - function to use for range queries
+     * @param square_only - only keep the levels of squares
+     */
+    SparseTable2D(const std::vector<std::vector<T>> &grid, T (*f)(T, T), bool square_only = false)
+            : square_only(square_only), func(f){
+        if(grid.empty() || grid[0].empty())
+            throw std::runtime_error("Grid is empty");
+        rows = grid.size();
+        cols = grid[0].size();
+        for(auto &row : grid)
+            if((int) row.size() != cols)
+                throw std::runtime_error("Rows have different lengths");
+        row_levels = std::bit_width((unsigned) rows);
+        col_levels = std::bit_width((unsigned) cols);
+        if(square_only)
+            row_levels = col_levels = std::min(row_levels, col_levels);
+        offsets.resize(square_only ? row_levels : row_levels * col_levels);
+        allocate();
+        for(int r = 0; r < rows; r++)
+            std::copy(grid[r].begin(), grid[r].end(), table.begin() + (std::size_t) r * cols);
+        if(square_only)
+            build_squares();
+        else
+            build_rectangles();
+    }
+
+    /**
+     * @brief Range Query
+     * @param r1 - top row
+     * @param c1 - left column
+     * @param r2 - bottom row, inclusive
+     * @param c2 - right column, inclusive
+     * @return result of range query
+     */
+    T query(int r1, int c1, int r2, int c2) const{
+        if(square_only)
+            return query_squares(r1, c1, r2, c2);
+        int a = std::bit_width((unsigned) (r2 - r1 + 1)) - 1;
+        int b = std::bit_width((unsigned) (c2 - c1 + 1)) - 1;
+        int r = r2 - (1 << a) + 1, c = c2 - (1 << b) + 1;
+        return func(func(at(a, b, r1, c1), at(a, b, r1, c)), func(at(a, b, r, c1), at(a, b, r, c)));
+    }
+
+    /**
+     * @brief Get the memory used by the table in bytes
+     */
+    std::size_t memory() const{
+        return table.size() * sizeof(T) + offsets.size() * sizeof(std::size_t);
+    }
+};
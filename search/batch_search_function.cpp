@@ -0,0 +1,110 @@
+/****************************************************************
+ * @file
+ * @brief Batch search on functions tests
+ * @details
+ * Checks the batch solvers against the scalar ones and compares
+ * time of solving many problems one by one and in lockstep
+****************************************************************/
+
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "batch_search_function.h"
+#include "binary_search.h"
+#include "golden_section_search.h"
+
+int main(){
+    // region test 1
+    std::vector<double> val = {4, 9, 2, 29.12};
+    std::vector<double> left(4, 0), right(4, 30), result(4);
+    batch_binary_search_function<double>([](double x){return x * x;}, val, left, right, result);
+    std::cout << "Test 1" << std::endl;
+    std::cout << "batch_binary_search_function(x * x, {4, 9, 2, 29.12}) = ";
+    for(auto x : result)
+        std::cout << x << " ";
+    std::cout << std::endl;
+    bool ok = true;
+    for(int i = 0; i < 4; i++)
+        ok = ok && std::fabs(result[i] - std::sqrt(val[i])) <= 1e-6;
+    std::cout << "correct answer = 2 3 1.41421 5.39630" << std::endl;
+    if(ok)
+        std::cout << "Test 1 passed" << std::endl;
+    else
+        std::cout << "Test 1 failed" << std::endl;
+    std::cout << std::endl;
+    // endregion
+
+    // region test 2
+    std::vector<double> peaks = {1, -2, 3.5};
+    std::vector<double> left2 = {-10, -10, 0}, right2 = {10, 0, 4}, result2(3);
+    batch_golden_section_search<double>([&](std::size_t i, double x){return -(x - peaks[i]) * (x - peaks[i]);},
+                                        left2, right2, result2);
+    std::cout << "Test 2" << std::endl;
+    std::cout << "batch_golden_section_search(-(x - peak[i])^2) = ";
+    for(auto x : result2)
+        std::cout << x << " ";
+    std::cout << std::endl;
+    std::cout << "correct answer = 1 -2 3.5" << std::endl;
+    ok = true;
+    for(int i = 0; i < 3; i++)
+        ok = ok && std::fabs(result2[i] - peaks[i]) <= 1e-6;
+    if(ok)
+        std::cout << "Test 2 passed" << std::endl;
+    else
+        std::cout << "Test 2 failed" << std::endl;
+    std::cout << std::endl;
+    // endregion
+
+    // region comparison
+    // solve x^3 + a[i] * x = c[i] and find the maximum of c[i] * x - x^4 for a million problems,
+    // golden-section answers differ a little because float values are flat near the maximum
+    const int n = 1 << 20;
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<float> dist(1, 100);
+    std::vector<float> a(n), c(n), lo(n, 0), hi(n, 10), batch(n), scalar(n);
+    for(int i = 0; i < n; i++){
+        a[i] = dist(rng);
+        c[i] = dist(rng);
+    }
+    auto cubic = [&](std::size_t i, float x){return x * x * x + a[i] * x;};
+    auto quartic = [&](std::size_t i, float x){return c[i] * x - x * x * x * x;};
+
+    auto start = std::chrono::steady_clock::now();
+    for(int i = 0; i < n; i++){
+        float l = lo[i], r = hi[i];
+        while(r - l > 1e-5f){
+            float mid = l + (r - l) / 2;
+            if(cubic(i, mid) < c[i])
+                l = mid;
+            else
+                r = mid;
+        }
+        scalar[i] = (l + r) / 2;
+    }
+    auto mid = std::chrono::steady_clock::now();
+    batch_binary_search_function<float>(cubic, c, lo, hi, batch, 1e-5f);
+    auto end = std::chrono::steady_clock::now();
+    float diff = 0;
+    for(int i = 0; i < n; i++)
+        diff = std::max(diff, std::fabs(batch[i] - scalar[i]));
+    std::cout << "Binary search on " << n << " problems: one by one "
+              << std::chrono::duration<double, std::milli>(mid - start).count() << " ms, batch "
+              << std::chrono::duration<double, std::milli>(end - mid).count() << " ms, max difference " << diff << std::endl;
+
+    start = std::chrono::steady_clock::now();
+    for(int i = 0; i < n; i++)
+        scalar[i] = (float) golden_section_search([&](double x){return (double) quartic(i, (float) x);}, lo[i], hi[i], 1e-4);
+    mid = std::chrono::steady_clock::now();
+    batch_golden_section_search<float>(quartic, lo, hi, batch, 1e-4f);
+    end = std::chrono::steady_clock::now();
+    diff = 0;
+    for(int i = 0; i < n; i++)
+        diff = std::max(diff, std::fabs(batch[i] - scalar[i]));
+    std::cout << "Golden-section search on " << n << " problems: one by one "
+              << std::chrono::duration<double, std::milli>(mid - start).count() << " ms, batch "
+              << std::chrono::duration<double, std::milli>(end - mid).count() << " ms, max difference " << diff << std::endl;
+    // endregion
+    return 0;
+}
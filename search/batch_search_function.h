@@ -0,0 +1,155 @@
+/****************************************************************
+ * @file
+ * @brief Batch search on functions
+ * @details
+ * Solves many independent problems at once: binary search for the root of
+ * monotone functions and golden-section search for the extremum of unimodal
+ * functions.
+ *
+ * Problems are processed in tiles that stay in L1 cache, and all problems
+ * of a tile make the same number of steps in lockstep. The step has no
+ * branches that depend on a problem, so when the callable can be inlined
+ * the compiler evaluates it for several problems per SIMD instruction.
+ * Golden-section search keeps one inner point per problem, the other one
+ * is its mirror in the range.
+ *
+ * The callable is either f(x), the same function for every problem,
+ * or f(i, x), the function of the i-th problem.
+ *
+ * ### Complexity
+ *
+ * Binary search : O(log2 ((r - l) / eps)) evaluations per problem
+ * Golden-section search : O(log1.618 ((r - l) / eps)) evaluations per problem
+ * Space Complexity : O(1) besides the output
+****************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+
+namespace batch_search_detail{
+    // problems per tile, a few arrays of them fit in L1 cache
+    constexpr std::size_t TILE = 256;
+
+    /**
+     * @brief Evaluate the function of the i-th problem
+     */
+    template <typename F, typename T>
+    T evaluate(F &f, std::size_t i, T x){
+        if constexpr(std::is_invocable_v<F &, std::size_t, T>)
+            return f(i, x);
+        else
+            return f(x);
+    }
+
+    /**
+     * @brief Number of steps that shrink every range of a tile below eps
+     * @param left - left borders
+     * @param right - right borders
+     * @param eps - precision
+     * @param ratio - how many times a step shrinks the range
+     * @returns number of steps
+     */
+    template <typename T>
+    int steps(std::span<const T> left, std::span<const T> right, T eps, double ratio){
+        T width = 0;
+        for(std::size_t i = 0; i < left.size(); i++)
+            width = std::max(width, right[i] - left[i]);
+        if(width <= eps)
+            return 0;
+        return (int) std::ceil(std::log((double) width / (double) eps) / std::log(ratio));
+    }
+}
+
+/****************************************************************
+ * @brief Batch binary search on monotonically increasing functions
+ * @param f - f(x) or f(i, x), function of the i-th problem
+ * @param val - val[i] is the value to search for the i-th problem
+ * @param left - left borders
+ * @param right - right borders
+ * @param res - res[i] receives the argument where f reaches val[i]
+ * @param eps - precision of search
+ ****************************************************************/
+template <typename T, typename F>
+void batch_binary_search_function(F f, std::span<const T> val, std::span<const T> left, std::span<const T> right,
+                                  std::span<T> res, T eps = 1e-6){
+    static_assert(std::is_floating_point_v<T>, "batch search works on floating point problems");
+    using namespace batch_search_detail;
+    if(left.size() != val.size() || right.size() != val.size() || res.size() != val.size())
+        throw std::runtime_error("Spans have different sizes");
+    T lo[TILE], hi[TILE];
+    for(std::size_t start = 0; start < val.size(); start += TILE){
+        std::size_t m = std::min(TILE, val.size() - start);
+        std::copy_n(left.begin() + start, m, lo);
+        std::copy_n(right.begin() + start, m, hi);
+        int k = steps<T>({lo, m}, {hi, m}, eps, 2);
+        const T *v = val.data() + start;
+        while(k--){
+            for(std::size_t i = 0; i < m; i++){
+                T l = lo[i], h = hi[i];
+                T mid = l + (h - l) / 2;
+                // quiet comparison and selects, GCC vectorizes this form
+                bool less = std::isless(evaluate(f, start + i, mid), v[i]);
+                lo[i] = less ? mid : l;
+                hi[i] = less ? h : mid;
+            }
+        }
+        for(std::size_t i = 0; i < m; i++)
+            res[start + i] = (lo[i] + hi[i]) / 2;
+    }
+}
+
+/****************************************************************
+ * @brief Batch golden-section search on unimodal functions
+ * @param f - f(x) or f(i, x), function of the i-th problem
+ * @param left - left borders
+ * @param right - right borders
+ * @param res - res[i] receives the argument of extremum of the i-th problem
+ * @param eps - precision
+ * @param is_max - true if we need to find maximum, false if we need to find minimum
+ ****************************************************************/
+template <typename T, typename F>
+void batch_golden_section_search(F f, std::span<const T> left, std::span<const T> right, std::span<T> res,
+                                 T eps = 1e-6, bool is_max = true){
+    static_assert(std::is_floating_point_v<T>, "batch search works on floating point problems");
+    using namespace batch_search_detail;
+    if(right.size() != left.size() || res.size() != left.size())
+        throw std::runtime_error("Spans have different sizes");
+    const T inv_phi = (T) ((std::sqrt(5.0) - 1) / 2);
+    const T sign = is_max ? 1 : -1;  // search maximum of sign * f
+    // a problem keeps its range and one inner point, the other inner point is its mirror a + b - x
+    T a[TILE], b[TILE], x[TILE], fx[TILE];
+    for(std::size_t start = 0; start < left.size(); start += TILE){
+        std::size_t m = std::min(TILE, left.size() - start);
+        std::copy_n(left.begin() + start, m, a);
+        std::copy_n(right.begin() + start, m, b);
+        int k = steps<T>({a, m}, {b, m}, eps, 1 / (double) inv_phi);
+        for(std::size_t i = 0; i < m; i++){
+            x[i] = a[i] + inv_phi * (b[i] - a[i]);
+            fx[i] = sign * evaluate(f, start + i, x[i]);
+        }
+        while(k--){
+            for(std::size_t i = 0; i < m; i++){
+                // one new evaluation per step, the better point stays inside and the range is cut at the worse one
+                T l = a[i], r = b[i], p = x[i], fp = fx[i];
+                T q = l + r - p;
+                T fq = sign * evaluate(f, start + i, q);
+                bool q_better = std::isless(fp, fq);
+                T best = q_better ? q : p;
+                T worst = q_better ? p : q;
+                bool worst_left = std::isless(worst, best);
+                a[i] = worst_left ? worst : l;
+                b[i] = worst_left ? r : worst;
+                x[i] = best;
+                fx[i] = std::max(fp, fq);
+            }
+        }
+        for(std::size_t i = 0; i < m; i++)
+            res[start + i] = (a[i] + b[i]) / 2;
+    }
+}
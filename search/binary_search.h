@@ -0,0 +1,63 @@
+/****************************************************************
+ * @file
+ * @brief Binary Search Algorithm
+ * @details
+ * Binary Search is a searching algorithm that finds the position of a target value within a sorted array.
+ *
+ * ### Complexity
+ *
+ * Worst-case performance  O(log n)
+ * Best-case performance  O(1)
+ * Average performance  O(log n)
+ * Worst-case space complexity  O(1)
+****************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+/****************************************************************
+ * @brief Binary search algorithm
+ * @param arr - array to search in
+ * @param val - value to search
+ * @return index of key in array or -1 if not found
+ ****************************************************************/
+template <typename T>
+std::ptrdiff_t binary_search(const std::vector<T> &arr, const T &val) {
+    std::ptrdiff_t left = 0;  // left border of array
+    std::ptrdiff_t right = (std::ptrdiff_t) arr.size() - 1;  // right border of array
+
+    while(left <= right){
+        std::ptrdiff_t mid = left + (right - left) / 2;
+        // if mid is val, return it, else update borders
+        if(arr[mid] == val)
+            return mid;
+        else if(val < arr[mid])
+            right = mid - 1;
+        else
+            left = mid + 1;
+    }
+    return -1;
+}
+
+/****************************************************************
+ * @brief Binary search on function algorithm
+ * @param func - monotonically increasing function to search in
+ * @param val - value to search
+ * @param left - left border of function
+ * @param right - right border of function
+ * @param eps - precision of search
+ * @return argument of function that is equal to val
+ ****************************************************************/
+template <typename T>
+T binary_search_function(T (*func)(T), T val, T left = 0, T right = 1e3, T eps = 1e-6){
+    while(right - left > eps){
+        T mid = left + (right - left) / 2;
+        if(func(mid) < val)
+            left = mid;
+        else
+            right = mid;
+    }
+    return (left + right) / 2;
+}
@@ -0,0 +1,75 @@
+/****************************************************************
+ * @file
+ * @brief Exponential Search tests
+****************************************************************/
+
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "exponential_search.h"
+
+int main(){
+    // region test 1
+    std::vector<int> arr = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    auto result = exponential_search(arr, 5);
+    std::cout << "Test 1" << std::endl;
+    std::cout << "arr = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10}" << std::endl;
+    std::cout << "exponential_search(arr, 5) = " << result << std::endl;
+    std::cout << "correct answer = 4" << std::endl;
+    if(result == 4)
+        std::cout << "Test 1 passed" << std::endl;
+    else
+        std::cout << "Test 1 failed" << std::endl;
+    std::cout << std::endl;
+    // endregion
+
+    // region test 2
+    auto result2 = exponential_search(arr, 3, 8);
+    std::cout << "Test 2" << std::endl;
+    std::cout << "exponential_search(arr, 3, 8) = " << result2 << std::endl;
+    std::cout << "correct answer = 2" << std::endl;
+    if(result2 == 2)
+        std::cout << "Test 2 passed" << std::endl;
+    else
+        std::cout << "Test 2 failed" << std::endl;
+    std::cout << std::endl;
+    // endregion
+
+    // region test 3
+    std::vector<std::string> arr3 = {"a", "aaa", "abc", "b", "zxc"};
+    auto result3 = exponential_search(arr3, std::string("abd"));
+    std::cout << "Test 3" << std::endl;
+    std::cout << "arr3 = {\"a\", \"aaa\", \"abc\", \"b\", \"zxc\"}" << std::endl;
+    std::cout << "exponential_search(arr3, \"abd\") = " << result3 << std::endl;
+    std::cout << "correct answer = -1" << std::endl;
+    if(result3 == -1)
+        std::cout << "Test 3 passed" << std::endl;
+    else
+        std::cout << "Test 3 failed" << std::endl;
+    std::cout << std::endl;
+    // endregion
+
+    // region random test
+    std::mt19937 rng(42);
+    bool ok = true;
+    for(int n = 0; n <= 300 && ok; n++){
+        std::vector<int> arr4(n);
+        for(auto &x : arr4)
+            x = (int) (rng() % 100);
+        std::sort(arr4.begin(), arr4.end());
+        for(int val = -1; val <= 101 && ok; val++){
+            auto expected = std::lower_bound(arr4.begin(), arr4.end(), val) - arr4.begin();
+            for(int hint = -1; hint <= n + 1 && ok; hint += 1 + n / 10)
+                ok = gallop_lower_bound(arr4, val, hint) == expected;
+        }
+    }
+    std::cout << "Random test" << std::endl;
+    if(ok)
+        std::cout << "Random test passed" << std::endl;
+    else
+        std::cout << "Random test failed" << std::endl;
+    // endregion
+    return 0;
+}
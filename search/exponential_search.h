@@ -0,0 +1,75 @@
+/****************************************************************
+ * @file
+ * @brief Exponential Search Algorithm
+ * @details
+ * Exponential (galloping) search starts from a hint and checks the elements
+ * at distance 1, 2, 4, 8... until it steps over the value, then runs
+ * binary search inside the last step.
+ * The cost depends on the distance d between the hint and the answer,
+ * not on the size of the array, so it is the right choice when the key is
+ * near the front or, in merges, near the previous answer.
+ *
+ * ### Complexity
+ *
+ * Worst-case performance  O(log d)
+ * Best-case performance  O(1)
+ * Average performance  O(log d)
+ * Worst-case space complexity  O(1)
+ * Where d is the distance between the hint and the answer
+****************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+/****************************************************************
+ * @brief Galloping search for the first element not less than val
+ * @param arr - sorted array to search in
+ * @param val - value to search
+ * @param hint - position to start from
+ * @return position of the lower bound, size of the array if every element is less than val
+ ****************************************************************/
+template <typename T>
+std::ptrdiff_t gallop_lower_bound(const std::vector<T> &arr, const T &val, std::ptrdiff_t hint = 0){
+    std::ptrdiff_t n = (std::ptrdiff_t) arr.size();
+    hint = std::clamp<std::ptrdiff_t>(hint, 0, n);
+    std::ptrdiff_t left, right;  // the answer is in (left, right]
+    if(hint < n && arr[hint] < val){
+        // gallop to the right
+        std::ptrdiff_t step = 1;
+        left = hint;
+        while(left + step < n && arr[left + step] < val){
+            left += step;
+            step *= 2;
+        }
+        right = std::min(left + step, n);
+    }
+    else{
+        // gallop to the left
+        std::ptrdiff_t step = 1;
+        right = hint;
+        while(right - step >= 0 && !(arr[right - step] < val)){
+            right -= step;
+            step *= 2;
+        }
+        left = std::max<std::ptrdiff_t>(right - step, -1);
+    }
+    return std::lower_bound(arr.begin() + (left + 1), arr.begin() + right, val) - arr.begin();
+}
+
+/****************************************************************
+ * @brief Exponential search algorithm
+ * @param arr - sorted array to search in
+ * @param val - value to search
+ * @param hint - position to start from, the front of the array by default
+ * @return index of key in array or -1 if not found
+ ****************************************************************/
+template <typename T>
+std::ptrdiff_t exponential_search(const std::vector<T> &arr, const T &val, std::ptrdiff_t hint = 0){
+    std::ptrdiff_t i = gallop_lower_bound(arr, val, hint);
+    if(i == (std::ptrdiff_t) arr.size() || !(arr[i] == val))
+        return -1;
+    return i;
+}
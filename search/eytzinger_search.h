@@ -0,0 +1,119 @@
+/****************************************************************
+ * @file
+ * @brief Eytzinger Search Data Structure
+ * @details
+ * Static search index over a sorted array, stored in Eytzinger (BFS) order:
+ * the root is at index 1 and the children of node k are 2k and 2k + 1.
+ * The first levels of the tree share a few cache lines, and the descendants of
+ * a node four levels down are adjacent in memory, so they can be prefetched
+ * while the current comparison is still in flight.
+ * The search loop is branchless: the tree is always walked to the bottom
+ * and the answer is restored from the bits of the final index.
+ *
+ * ### Complexity
+ *
+ * Build : O(n)
+ * Search : O(log n)
+ * Space Complexity : O(n)
+****************************************************************/
+
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <vector>
+
+template <typename T>
+class EytzingerSearch{
+    // elements that fit in one 64-byte cache line, used as prefetch distance
+    static constexpr std::size_t BLOCK = 64 / sizeof(T) > 0 ? 64 / sizeof(T) : 1;
+
+    std::vector<T> tree;  // tree[k] is the key of node k, tree[0] is unused
+    std::vector<std::ptrdiff_t> index;  // index[k] is the position of tree[k] in the sorted array
+    std::size_t n;  // size of input array
+
+    /**
+     * @brief Fills the tree with an in-order walk over the sorted array
+     * @param arr - sorted input array
+     * @param i - current position in the sorted array
+     * @param k - current node
+     * @returns next position in the sorted array
+     */
+    std::size_t build(const std::vector<T> &arr, std::size_t i, std::size_t k){
+        if(k <= n){
+            i = build(arr, i, 2 * k);
+            tree[k] = arr[i];
+            index[k] = (std::ptrdiff_t) i;
+            i++;
+            i = build(arr, i, 2 * k + 1);
+        }
+        return i;
+    }
+
+public:
+    /**
+     * @brief Constructor
+     * @param arr - sorted input array
+     */
+    explicit EytzingerSearch(const std::vector<T> &arr){
+        n = arr.size();
+        tree.resize(n + 1);
+        index.resize(n + 1, -1);
+        build(arr, 0, 1);
+    }
+
+    /**
+     * @brief Get the node of the first element not less than val
+     * @param val - value to search
+     * @returns node in Eytzinger order or 0 if every element is less than val
+     */
+    std::size_t lower_bound_node(const T &val) const{
+        std::size_t k = 1;
+        while(k <= n){
+#if defined(__GNUC__)
+            __builtin_prefetch(tree.data() + k * BLOCK);
+#endif
+            k = 2 * k + (tree[k] < val);
+        }
+        // drop the trailing right turns and the last left turn
+        return k >> (std::countr_one(k) + 1);
+    }
+
+    /**
+     * @brief Get the position of the first element not less than val
+     * @param val - value to search
+     * @returns position in the sorted array or size of the array if every element is less than val
+     */
+    std::ptrdiff_t lower_bound(const T &val) const{
+        std::size_t k = lower_bound_node(val);
+        return k == 0 ? (std::ptrdiff_t) n : index[k];
+    }
+
+    /**
+     * @brief Search for a value
+     * @param val - value to search
+     * @returns index of key in the sorted array or -1 if not found
+     */
+    std::ptrdiff_t search(const T &val) const{
+        std::size_t k = lower_bound_node(val);
+        if(k == 0 || !(tree[k] == val))
+            return -1;
+        return index[k];
+    }
+
+    /**
+     * @brief Get size of the index
+     * @returns number of elements
+     */
+    std::size_t size() const{
+        return n;
+    }
+
+    /**
+     * @brief Get memory used by the index
+     * @returns size in bytes
+     */
+    std::size_t memory() const{
+        return tree.capacity() * sizeof(T) + index.capacity() * sizeof(std::ptrdiff_t);
+    }
+};
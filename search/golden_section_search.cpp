@@ -0,0 +1,61 @@
+/****************************************************************
+ * @file
+ * @brief Golden-section search tests
+****************************************************************/
+
+#include <iostream>
+#include <cmath>
+#include "golden_section_search.h"
+#include "ternary_search.h"
+
+int evaluations = 0;  // number of function calls in the current test
+
+double parabola(double x){
+    evaluations++;
+    return -(x - 3) * (x - 3);
+}
+
+int main(){
+    // region test 1
+    double result = golden_section_search([](double x){return x * x;}, 0, 10, 0.0001);
+    std::cout << "Test 1" << std::endl;
+    std::cout << "golden_section_search([](double x){return x * x;}, 0, 10, 0.0001) = " << result << std::endl;
+    std::cout << "correct answer = 10" << std::endl;
+    if(fabs(result - 10) < 0.0001)
+        std::cout << "Test 1 passed" << std::endl;
+    else
+        std::cout << "Test 1 failed" << std::endl;
+    std::cout << std::endl;
+    // endregion
+
+    // region test 2
+    double result2 = golden_section_search([](double x){return x * x;}, -5, 10, 0.0001, false);
+    std::cout << "Test 2" << std::endl;
+    std::cout << "golden_section_search([](double x){return x * x;}, -5, 10, 0.0001, false) = " << result2 << std::endl;
+    std::cout << "correct answer = 0" << std::endl;
+    if(fabs(result2) < 0.0001)
+        std::cout << "Test 2 passed" << std::endl;
+    else
+        std::cout << "Test 2 failed" << std::endl;
+    std::cout << std::endl;
+    // endregion
+
+    // region test 3
+    evaluations = 0;
+    double result3 = golden_section_search(parabola, 0, 10, 1e-9);
+    int golden_evaluations = evaluations;
+    evaluations = 0;
+    double result3_ternary = ternary_search_function(parabola, 0, 10, 1e-9);
+    std::cout << "Test 3" << std::endl;
+    std::cout << "golden_section_search(parabola, 0, 10, 1e-9) = " << result3
+              << ", " << golden_evaluations << " evaluations" << std::endl;
+    std::cout << "ternary_search_function(parabola, 0, 10, 1e-9) = " << result3_ternary
+              << ", " << evaluations << " evaluations" << std::endl;
+    std::cout << "correct answer = 3" << std::endl;
+    if(fabs(result3 - 3) < 1e-6 && golden_evaluations < evaluations)
+        std::cout << "Test 3 passed" << std::endl;
+    else
+        std::cout << "Test 3 failed" << std::endl;
+    // endregion
+    return 0;
+}
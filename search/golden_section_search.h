@@ -0,0 +1,57 @@
+/****************************************************************
+ * @file
+ * @brief Golden-section search Algorithm
+ * @details
+ * Golden-section search finds maximum or minimum of a unimodal function,
+ * like ternary search, but places the two inner points at the golden ratio.
+ * After the range shrinks, one of the old inner points is exactly an inner
+ * point of the new range, so every step needs only one new evaluation
+ * instead of two, and the range shrinks 1.618 times per evaluation
+ * instead of 1.225 times.
+ *
+ * ### Complexity
+ *
+ * Average performance  O(log1.618 ((r - l) / eps)) evaluations
+ * Worst-case space complexity  O(1)
+****************************************************************/
+
+#pragma once
+
+#include <cmath>
+
+/****************************************************************
+ * @brief Golden-section search on function algorithm
+ * @param f - unimodal function to search in
+ * @param l - left border of function
+ * @param r - right border of function
+ * @param eps - precision
+ * @param is_max - true if we need to find maximum, false if we need to find minimum
+ * @return argument of minimum or maximum of function
+ ****************************************************************/
+template <typename F>
+double golden_section_search(F f, double l, double r, double eps, bool is_max = true){
+    const double inv_phi = (std::sqrt(5.0) - 1) / 2;
+    double x1 = r - inv_phi * (r - l);
+    double x2 = l + inv_phi * (r - l);
+    double f1 = f(x1);
+    double f2 = f(x2);
+    while(r - l > eps){
+        if(is_max ? f1 < f2 : f1 > f2){
+            // drop [l, x1], x2 becomes the left inner point
+            l = x1;
+            x1 = x2;
+            f1 = f2;
+            x2 = l + inv_phi * (r - l);
+            f2 = f(x2);
+        }
+        else{
+            // drop [x2, r], x1 becomes the right inner point
+            r = x2;
+            x2 = x1;
+            f2 = f1;
+            x1 = r - inv_phi * (r - l);
+            f1 = f(x1);
+        }
+    }
+    return (l + r) / 2;
+}
@@ -0,0 +1,79 @@
+/****************************************************************
+ * @file
+ * @brief Interpolation Search tests
+****************************************************************/
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "interpolation_search.h"
+
+int main(){
+    // region test 1
+    std::vector<int> arr = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    auto result = interpolation_search(arr, 5);
+    std::cout << "Test 1" << std::endl;
+    std::cout << "arr = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10}" << std::endl;
+    std::cout << "interpolation_search(arr, 5) = " << result << std::endl;
+    std::cout << "correct answer = 4" << std::endl;
+    if(result == 4)
+        std::cout << "Test 1 passed" << std::endl;
+    else
+        std::cout << "Test 1 failed" << std::endl;
+    std::cout << std::endl;
+    // endregion
+
+    // region test 2
+    std::vector<double> arr2 = {1.1, 2.2, 3.3, 4.4, 5.5, 6.6, 7.7, 8.8, 9.9, 10.1};
+    auto result2 = interpolation_search(arr2, 5.5);
+    std::cout << "Test 2" << std::endl;
+    std::cout << "arr2 = {1.1, 2.2, 3.3, 4.4, 5.5, 6.6, 7.7, 8.8, 9.9, 10.1}" << std::endl;
+    std::cout << "interpolation_search(arr2, 5.5) = " << result2 << std::endl;
+    std::cout << "correct answer = 4" << std::endl;
+    if(result2 == 4)
+        std::cout << "Test 2 passed" << std::endl;
+    else
+        std::cout << "Test 2 failed" << std::endl;
+    std::cout << std::endl;
+    // endregion
+
+    // region test 3
+    auto result3 = interpolation_search(arr, 11);
+    std::cout << "Test 3" << std::endl;
+    std::cout << "interpolation_search(arr, 11) = " << result3 << std::endl;
+    std::cout << "correct answer = -1" << std::endl;
+    if(result3 == -1)
+        std::cout << "Test 3 passed" << std::endl;
+    else
+        std::cout << "Test 3 failed" << std::endl;
+    std::cout << std::endl;
+    // endregion
+
+    // region random test
+    std::mt19937_64 rng(42);
+    bool ok = true;
+    for(int n = 0; n <= 2000 && ok; n += 1 + n / 4){
+        std::vector<std::int64_t> arr4(n);
+        for(auto &x : arr4){
+            // mix of uniform and heavily skewed keys with duplicates
+            std::int64_t r = (std::int64_t) (rng() % 1000);
+            x = n % 2 ? r : r * r * r - 500000000;
+        }
+        std::sort(arr4.begin(), arr4.end());
+        for(int q = 0; q < 300 && ok; q++){
+            std::int64_t val = n > 0 && q % 2 ? arr4[rng() % n] : (std::int64_t) (rng() % 2000) - 1000;
+            auto res = interpolation_search(arr4, val);
+            bool expected = std::binary_search(arr4.begin(), arr4.end(), val);
+            ok = expected ? res != -1 && arr4[res] == val : res == -1;
+        }
+    }
+    std::cout << "Random test" << std::endl;
+    if(ok)
+        std::cout << "Random test passed" << std::endl;
+    else
+        std::cout << "Random test failed" << std::endl;
+    // endregion
+    return 0;
+}
@@ -0,0 +1,68 @@
+/****************************************************************
+ * @file
+ * @brief Interpolation Search Algorithm
+ * @details
+ * Interpolation search guesses the position of the value by linear
+ * interpolation between the borders of the range, like looking up a word
+ * in a dictionary. On uniformly distributed keys the range shrinks
+ * to about sqrt of its size every step.
+ * On skewed keys the guesses can be poor, so after 2 * log2(n) guesses
+ * the search falls back to halving the range.
+ *
+ * ### Complexity
+ *
+ * Worst-case performance  O(log n)
+ * Best-case performance  O(1)
+ * Average performance  O(log log n) on uniform data
+ * Worst-case space complexity  O(1)
+****************************************************************/
+
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <type_traits>
+#include <vector>
+
+/****************************************************************
+ * @brief Interpolation search algorithm
+ * @param arr - sorted array of numbers to search in
+ * @param val - value to search
+ * @return index of key in array or -1 if not found
+ ****************************************************************/
+template <typename T>
+std::ptrdiff_t interpolation_search(const std::vector<T> &arr, const T &val){
+    static_assert(std::is_arithmetic_v<T>, "interpolation_search needs numeric keys");
+    // distance between two keys that does not overflow
+    auto distance = [](T x, T y){
+        if constexpr(std::is_integral_v<T>)
+            return (double) ((std::make_unsigned_t<T>) x - (std::make_unsigned_t<T>) y);
+        else
+            return (double) (x - y);
+    };
+    std::ptrdiff_t left = 0;  // left border of array
+    std::ptrdiff_t right = (std::ptrdiff_t) arr.size() - 1;  // right border of array
+    int guesses = 2 * std::bit_width(arr.size());  // interpolation steps before falling back to halving
+
+    while(left <= right && !(val < arr[left]) && !(arr[right] < val)){
+        if(arr[left] == arr[right])
+            return arr[left] == val ? left : -1;
+        std::ptrdiff_t mid;
+        if(guesses-- > 0){
+            double ratio = distance(val, arr[left]) / distance(arr[right], arr[left]);
+            mid = left + (std::ptrdiff_t) (ratio * (double) (right - left));
+            if(mid > right)
+                mid = right;
+        }
+        else
+            mid = left + (right - left) / 2;
+        // if mid is val, return it, else update borders
+        if(arr[mid] == val)
+            return mid;
+        else if(val < arr[mid])
+            right = mid - 1;
+        else
+            left = mid + 1;
+    }
+    return -1;
+}
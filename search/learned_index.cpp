@@ -0,0 +1,117 @@
+/****************************************************************
+ * @file
+ * @brief Learned Index tests and comparison
+ * @details
+ * Checks LearnedIndex against std::lower_bound and compares lookup latency
+ * and memory with binary search and the Eytzinger layout
+****************************************************************/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "binary_search.h"
+#include "eytzinger_search.h"
+#include "learned_index.h"
+
+/****************************************************************
+ * @brief Measure average lookup time
+ * @param queries - values to search
+ * @param search - function returning index of a value or -1
+ * @return nanoseconds per lookup
+ ****************************************************************/
+template <typename T, typename F>
+double measure(const std::vector<T> &queries, F search){
+    auto start = std::chrono::steady_clock::now();
+    long long checksum = 0;
+    for(auto &q : queries)
+        checksum += (long long) search(q);
+    auto end = std::chrono::steady_clock::now();
+    if(checksum == 42)
+        std::cout << "";
+    return std::chrono::duration<double, std::nano>(end - start).count() / (double) queries.size();
+}
+
+int main(){
+    // region test 1
+    std::vector<int> arr = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    LearnedIndex<int> index(arr);
+    auto result = index.search(5);
+    std::cout << "Test 1" << std::endl;
+    std::cout << "arr = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10}" << std::endl;
+    std::cout << "index.search(5) = " << result << std::endl;
+    std::cout << "correct answer = 4" << std::endl;
+    if(result == 4)
+        std::cout << "Test 1 passed" << std::endl;
+    else
+        std::cout << "Test 1 failed" << std::endl;
+    std::cout << std::endl;
+    // endregion
+
+    // region test 2
+    auto result2 = index.search(11);
+    std::cout << "Test 2" << std::endl;
+    std::cout << "index.search(11) = " << result2 << std::endl;
+    std::cout << "correct answer = -1" << std::endl;
+    if(result2 == -1)
+        std::cout << "Test 2 passed" << std::endl;
+    else
+        std::cout << "Test 2 failed" << std::endl;
+    std::cout << std::endl;
+    // endregion
+
+    // region random test
+    std::mt19937_64 rng(42);
+    bool ok = true;
+    for(int n : {0, 1, 2, 100, 1000, 100000}){
+        for(std::uint64_t range : {10ull, 1000ull, 1ull << 40, ~0ull}){
+            std::vector<std::uint64_t> arr3(n);
+            for(auto &x : arr3)
+                x = range == ~0ull ? rng() : rng() % range;
+            // skewed keys, squares of uniform values
+            if(range == 1ull << 40)
+                for(auto &x : arr3)
+                    x = (x >> 20) * (x >> 20);
+            std::sort(arr3.begin(), arr3.end());
+            for(std::size_t eps : {1, 8, 64}){
+                LearnedIndex<std::uint64_t> index3(arr3, eps);
+                for(int q = 0; q < 2000 && ok; q++){
+                    std::uint64_t val = q % 2 && n > 0 ? arr3[rng() % n] + q % 3 - 1 : rng() % (range == ~0ull ? range : 2 * range);
+                    auto expected = std::lower_bound(arr3.begin(), arr3.end(), val) - arr3.begin();
+                    ok = index3.lower_bound(val) == expected;
+                }
+            }
+        }
+    }
+    std::cout << "Random test" << std::endl;
+    if(ok)
+        std::cout << "Random test passed" << std::endl;
+    else
+        std::cout << "Random test failed" << std::endl;
+    std::cout << std::endl;
+    // endregion
+
+    // region comparison
+    int n = 1 << 22;
+    std::vector<std::uint64_t> keys(n), queries(n);
+    for(auto &x : keys)
+        x = rng();
+    std::sort(keys.begin(), keys.end());
+    for(int i = 0; i < n; i++)
+        queries[i] = i % 2 ? keys[rng() % n] : rng();
+
+    EytzingerSearch<std::uint64_t> eytzinger(keys);
+    LearnedIndex<std::uint64_t> learned(keys);
+    std::cout << "Comparison on " << n << " uniform 64-bit keys" << std::endl;
+    std::cout << "binary search: " << measure(queries, [&](std::uint64_t q){return binary_search(keys, q);})
+              << " ns, " << keys.size() * sizeof(std::uint64_t) << " bytes" << std::endl;
+    std::cout << "eytzinger: " << measure(queries, [&](std::uint64_t q){return eytzinger.search(q);})
+              << " ns, " << eytzinger.memory() << " bytes" << std::endl;
+    std::cout << "learned index: " << measure(queries, [&](std::uint64_t q){return learned.search(q);})
+              << " ns, " << learned.memory() << " bytes, model " << learned.model_memory() << " bytes, "
+              << learned.segments() << " segments, " << learned.height() << " levels" << std::endl;
+    // endregion
+    return 0;
+}
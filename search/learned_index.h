@@ -0,0 +1,215 @@
+/****************************************************************
+ * @file
+ * @brief Learned Index Data Structure
+ * @details
+ * Learned index over a sorted array of numeric keys in the style of
+ * the PGM-index: the mapping from a key to its position is approximated by
+ * linear segments, each one guaranteed to be at most eps positions away
+ * from the true position of every key it covers.
+ * Segments are found greedily with a shrinking cone of feasible slopes.
+ * The first keys of the segments are indexed the same way, level by level,
+ * until one segment is left.
+ *
+ * A lookup walks the levels top-down: the segment predicts a position and
+ * only the window of 2 * eps + 1 elements around it is searched with
+ * kary_lower_bound from simd_search.h.
+ * On near-uniform keys a handful of segments covers the whole array.
+ *
+ * ### Complexity
+ *
+ * Build : O(n)
+ * Search : O(levels * log eps)
+ * Space Complexity : O(n) for the keys, O(segments) for the model
+****************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <vector>
+#include "simd_search.h"
+
+template <typename T>
+class LearnedIndex{
+    static_assert(std::is_arithmetic_v<T>, "LearnedIndex needs numeric keys");
+
+    struct Segment{
+        T key;  // first key covered by the segment
+        double slope;
+        std::size_t start;  // position of key in the array below
+    };
+
+    std::vector<T> data;  // sorted input array
+    std::vector<std::vector<Segment>> levels;  // levels[0] covers data, levels[l] covers the keys of levels[l - 1]
+    std::vector<std::vector<T>> keys;  // keys[l] are the first keys of levels[l], except the top one
+    std::size_t eps;  // maximum error of a segment
+
+    // region Helper Functions
+
+    /**
+     * @brief Distance between two keys that does not overflow
+     * @param x - larger key
+     * @param key - smaller key
+     * @returns x - key as double
+     */
+    static double distance(T x, T key){
+        if constexpr(std::is_integral_v<T>)
+            return (double) ((std::make_unsigned_t<T>) x - (std::make_unsigned_t<T>) key);
+        else
+            return (double) (x - key);
+    }
+
+    /**
+     * @brief Split points into segments with error at most eps
+     * @param arr - sorted keys, only the first occurrence of every key is a point
+     * @returns segments
+     */
+    std::vector<Segment> build_level(const std::vector<T> &arr){
+        std::vector<Segment> segments;
+        double low = 0, high = 0;
+        for(std::size_t i = 0; i < arr.size(); i++){
+            if(i > 0 && arr[i] == arr[i - 1])
+                continue;
+            if(!segments.empty()){
+                Segment &seg = segments.back();
+                double dx = distance(arr[i], seg.key);
+                double dy = (double) (i - seg.start);
+                double slope = dy / dx;
+                if(slope >= low && slope <= high){
+                    // narrow the cone so that every point stays within eps
+                    low = std::max(low, (dy - (double) eps) / dx);
+                    high = std::min(high, (dy + (double) eps) / dx);
+                    seg.slope = (low + high) / 2;
+                    continue;
+                }
+            }
+            segments.push_back({arr[i], 0, i});
+            low = 0;
+            high = std::numeric_limits<double>::infinity();
+        }
+        return segments;
+    }
+
+    /**
+     * @brief Search the window around a predicted position
+     * @param arr - sorted keys
+     * @param pos - predicted position
+     * @param val - value to search
+     * @returns position of the first element not less than val
+     */
+    std::size_t search_window(const std::vector<T> &arr, std::size_t pos, const T &val) const{
+        std::size_t left = pos > eps + 1 ? pos - eps - 1 : 0;
+        std::size_t right = std::min(arr.size(), pos + eps + 2);
+        std::size_t res = left + kary_lower_bound(arr.data() + left, right - left, val);
+        // runs of duplicates can be longer than the window, fall back to the rest of the array
+        if(res == right && right < arr.size())
+            res = std::lower_bound(arr.begin() + right, arr.end(), val) - arr.begin();
+        else if(res == left && left > 0 && !(arr[left - 1] < val))
+            res = std::lower_bound(arr.begin(), arr.begin() + left, val) - arr.begin();
+        return res;
+    }
+
+    /**
+     * @brief Predict the position of a value with a segment
+     * @param segments - level of the segment
+     * @param j - index of the segment
+     * @param size - size of the array below
+     * @param val - value to predict
+     * @returns predicted position, not outside the segment
+     */
+    static std::size_t predict(const std::vector<Segment> &segments, std::size_t j, std::size_t size, const T &val){
+        const Segment &seg = segments[j];
+        if(val < seg.key)
+            return seg.start;
+        std::size_t end = j + 1 < segments.size() ? segments[j + 1].start : size;
+        double pos = (double) seg.start + seg.slope * distance(val, seg.key);
+        return pos >= (double) end ? end : (std::size_t) pos;
+    }
+
+    // endregion
+
+public:
+    /**
+     * @brief Constructor
+     * @param arr - sorted input array
+     * @param eps - maximum distance between predicted and real position
+     */
+    explicit LearnedIndex(const std::vector<T> &arr, std::size_t eps = 64) : data(arr), eps(eps){
+        levels.push_back(build_level(data));
+        while(levels.back().size() > 1){
+            keys.emplace_back();
+            for(auto &seg : levels.back())
+                keys.back().push_back(seg.key);
+            levels.push_back(build_level(keys.back()));
+        }
+    }
+
+    /**
+     * @brief Get the position of the first element not less than val
+     * @param val - value to search
+     * @returns position in the sorted array or size of the array if every element is less than val
+     */
+    std::ptrdiff_t lower_bound(const T &val) const{
+        if(data.empty())
+            return 0;
+        std::size_t j = 0;  // segment on the current level
+        for(std::size_t l = levels.size() - 1; l > 0; l--){
+            const std::vector<T> &below = keys[l - 1];
+            std::size_t pos = search_window(below, predict(levels[l], j, below.size(), val), val);
+            // last segment of the level below whose first key is not greater than val
+            j = pos < below.size() && below[pos] == val ? pos : (pos > 0 ? pos - 1 : 0);
+        }
+        return (std::ptrdiff_t) search_window(data, predict(levels[0], j, data.size(), val), val);
+    }
+
+    /**
+     * @brief Search for a value
+     * @param val - value to search
+     * @returns index of key in the sorted array or -1 if not found
+     */
+    std::ptrdiff_t search(const T &val) const{
+        std::ptrdiff_t i = lower_bound(val);
+        if(i == (std::ptrdiff_t) data.size() || data[i] != val)
+            return -1;
+        return i;
+    }
+
+    /**
+     * @brief Get number of segments on the lowest level
+     * @returns number of segments
+     */
+    std::size_t segments() const{
+        return levels[0].size();
+    }
+
+    /**
+     * @brief Get number of levels
+     * @returns number of levels
+     */
+    std::size_t height() const{
+        return levels.size();
+    }
+
+    /**
+     * @brief Get memory used by the model without the keys
+     * @returns size in bytes
+     */
+    std::size_t model_memory() const{
+        std::size_t res = 0;
+        for(auto &level : levels)
+            res += level.capacity() * sizeof(Segment);
+        for(auto &level_keys : keys)
+            res += level_keys.capacity() * sizeof(T);
+        return res;
+    }
+
+    /**
+     * @brief Get memory used by the index
+     * @returns size in bytes
+     */
+    std::size_t memory() const{
+        return data.capacity() * sizeof(T) + model_memory();
+    }
+};
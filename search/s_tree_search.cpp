@@ -0,0 +1,88 @@
+/****************************************************************
+ * @file
+ * @brief S-tree Search tests
+ * @details
+ * Checks STreeSearch against binary search answers
+****************************************************************/
+
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "s_tree_search.h"
+
+int main(){
+    // region test 1
+    std::vector<int> arr = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    STreeSearch<int> index(arr);
+    auto result = index.search(5);
+    std::cout << "Test 1" << std::endl;
+    std::cout << "arr = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10}" << std::endl;
+    std::cout << "index.search(5) = " << result << std::endl;
+    std::cout << "correct answer = 4" << std::endl;
+    if(result == 4)
+        std::cout << "Test 1 passed" << std::endl;
+    else
+        std::cout << "Test 1 failed" << std::endl;
+    std::cout << std::endl;
+    // endregion
+
+    // region test 2
+    auto result2 = index.search(11);
+    std::cout << "Test 2" << std::endl;
+    std::cout << "index.search(11) = " << result2 << std::endl;
+    std::cout << "correct answer = -1" << std::endl;
+    if(result2 == -1)
+        std::cout << "Test 2 passed" << std::endl;
+    else
+        std::cout << "Test 2 failed" << std::endl;
+    std::cout << std::endl;
+    // endregion
+
+    // region test 3
+    std::vector<std::string> arr3 = {"a", "aaa", "abc", "b", "zxc"};
+    STreeSearch<std::string> index3(arr3);
+    auto result3 = index3.search("b");
+    std::cout << "Test 3" << std::endl;
+    std::cout << "arr3 = {\"a\", \"aaa\", \"abc\", \"b\", \"zxc\"}" << std::endl;
+    std::cout << "index3.search(\"b\") = " << result3 << std::endl;
+    std::cout << "correct answer = 3" << std::endl;
+    if(result3 == 3)
+        std::cout << "Test 3 passed" << std::endl;
+    else
+        std::cout << "Test 3 failed" << std::endl;
+    std::cout << std::endl;
+    // endregion
+
+    // region random test
+    std::mt19937 rng(42);
+    bool ok = true;
+    for(int n = 0; n <= 600 && ok; n++){
+        std::vector<int> arr4(n);
+        for(auto &x : arr4)
+            x = (int) (rng() % 1000);
+        std::sort(arr4.begin(), arr4.end());
+        STreeSearch<int> index4(arr4);
+        for(int val = -1; val <= 1001; val++){
+            auto expected = std::lower_bound(arr4.begin(), arr4.end(), val) - arr4.begin();
+            if(index4.lower_bound(val) != expected){
+                ok = false;
+                break;
+            }
+            bool found = index4.search(val) != -1;
+            if(found != std::binary_search(arr4.begin(), arr4.end(), val)
+               || (found && arr4[index4.search(val)] != val)){
+                ok = false;
+                break;
+            }
+        }
+    }
+    std::cout << "Random test" << std::endl;
+    if(ok)
+        std::cout << "Random test passed" << std::endl;
+    else
+        std::cout << "Random test failed" << std::endl;
+    // endregion
+    return 0;
+}
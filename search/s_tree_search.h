@@ -0,0 +1,151 @@
+/****************************************************************
+ * @file
+ * @brief S-tree (static B+ tree) Search Data Structure
+ * @details
+ * Static search index over a sorted array, stored as an implicit B+ tree
+ * whose nodes are exactly one 64-byte cache line.
+ * Every node holds B keys and has B + 1 children, child i of a node is found
+ * by arithmetic, so no pointers are stored.
+ * Layers are stored one after another starting from the leaves, which are
+ * the sorted array itself, so the rank found in a leaf is the answer.
+ * Inside a node all keys are compared at once with simd_rank from
+ * simd_search.h, which picks AVX2 or SSE4.2 at runtime for integer keys.
+ *
+ * ### Complexity
+ *
+ * Build : O(n)
+ * Search : O(log_(B+1) n), one cache miss per layer
+ * Space Complexity : O(n)
+****************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <vector>
+#include "simd_search.h"
+
+template <typename T>
+class STreeSearch{
+    // keys in one node, one 64-byte cache line
+    static constexpr int B = 64 / sizeof(T) >= 4 ? 64 / sizeof(T) : 4;
+
+    std::vector<T> tree;  // all layers, leaves first
+    std::vector<int> offsets;  // offsets[h] is the first key of layer h
+    int n;  // size of input array
+    int height;  // number of layers
+
+    // region Helper Functions
+
+    /**
+     * @brief Get the number of nodes needed for a layer
+     * @param keys - number of keys in the layer
+     * @returns number of nodes
+     */
+    static int blocks(int keys){
+        return (keys + B - 1) / B;
+    }
+
+    /**
+     * @brief Get the number of keys in the layer above
+     * @param keys - number of keys in the layer
+     * @returns number of keys in the parent layer
+     */
+    static int prev_keys(int keys){
+        return (blocks(keys) + B) / (B + 1) * B;
+    }
+
+    /**
+     * @brief Count keys of a node that are less than val
+     * @param node - pointer to the first key of the node
+     * @param val - value to compare with
+     * @returns number of keys less than val, from 0 to B
+     */
+    static int rank(const T *node, const T &val){
+        return (int) simd_rank(node, B, val);
+    }
+
+    // endregion
+
+    /**
+     * @brief Fills the internal layers with the first key of the right subtrees
+     */
+    void build(){
+        for(int h = 1; h < height; h++){
+            for(int i = 0; i < offsets[h + 1] - offsets[h]; i++){
+                // child to the right of the key, then always to the left down to the leaves
+                int k = i / B * (B + 1) + i % B + 1;
+                for(int l = 1; l < h; l++)
+                    k *= B + 1;
+                tree[offsets[h] + i] = (long long) k * B < n ? tree[k * B] : tree[n - 1];
+            }
+        }
+    }
+
+public:
+    /**
+     * @brief Constructor
+     * @param arr - sorted input array
+     */
+    explicit STreeSearch(const std::vector<T> &arr){
+        n = (int) arr.size();
+        height = 1;
+        offsets.push_back(0);
+        for(int keys = n;; keys = prev_keys(keys)){
+            offsets.push_back(offsets.back() + blocks(keys) * B);
+            if(keys <= B)
+                break;
+            height++;
+        }
+        if(n == 0)
+            return;
+        // padding repeats the largest key, it is never less than a value we descend with
+        tree.assign(offsets.back(), arr.back());
+        for(int i = 0; i < n; i++)
+            tree[i] = arr[i];
+        build();
+    }
+
+    /**
+     * @brief Get the position of the first element not less than val
+     * @param val - value to search
+     * @returns position in the sorted array or size of the array if every element is less than val
+     */
+    std::ptrdiff_t lower_bound(const T &val) const{
+        if(n == 0 || tree[n - 1] < val)
+            return n;
+        int k = 0;  // first key of the current node
+        for(int h = height - 1; h > 0; h--){
+            int i = rank(tree.data() + offsets[h] + k, val);
+            k = k * (B + 1) + i * B;
+        }
+        return k + rank(tree.data() + k, val);
+    }
+
+    /**
+     * @brief Search for a value
+     * @param val - value to search
+     * @returns index of key in the sorted array or -1 if not found
+     */
+    std::ptrdiff_t search(const T &val) const{
+        std::ptrdiff_t i = lower_bound(val);
+        if(i == n || !(tree[i] == val))
+            return -1;
+        return i;
+    }
+
+    /**
+     * @brief Get size of the index
+     * @returns number of elements
+     */
+    std::size_t size() const{
+        return n;
+    }
+
+    /**
+     * @brief Get memory used by the index
+     * @returns size in bytes
+     */
+    std::size_t memory() const{
+        return tree.capacity() * sizeof(T) + offsets.capacity() * sizeof(int);
+    }
+};
@@ -0,0 +1,93 @@
+/****************************************************************
+ * @file
+ * @brief Search algorithms benchmark
+ * @details
+ * Measures binary, ternary, interpolation and exponential search on
+ * different key distributions and query patterns and names the fastest
+ * algorithm for each of them.
+ *
+ * Key distributions: uniform, clustered, exponentially skewed.
+ * Query patterns: random keys, keys near the front, increasing keys
+ * (merge-style, exponential search starts from the previous answer).
+****************************************************************/
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "binary_search.h"
+#include "exponential_search.h"
+#include "interpolation_search.h"
+#include "ternary_search.h"
+
+/****************************************************************
+ * @brief Measure average lookup time
+ * @param queries - values to search
+ * @param search - function returning index of a value or -1
+ * @return nanoseconds per lookup
+ ****************************************************************/
+double measure(const std::vector<std::int64_t> &queries, const std::function<std::ptrdiff_t(std::int64_t)> &search){
+    auto start = std::chrono::steady_clock::now();
+    long long checksum = 0;
+    for(auto &q : queries)
+        checksum += search(q);
+    auto end = std::chrono::steady_clock::now();
+    if(checksum == 42)
+        std::cout << "";
+    return std::chrono::duration<double, std::nano>(end - start).count() / (double) queries.size();
+}
+
+int main(){
+    const int n = 1 << 20;
+    const int q = 1 << 18;
+    std::mt19937_64 rng(42);
+
+    std::vector<std::pair<std::string, std::function<std::int64_t()>>> distributions = {
+        {"uniform", [&]{return (std::int64_t) (rng() >> 2);}},
+        {"clustered", [&]{return (std::int64_t) (rng() % 64) * 1000000000000LL + (std::int64_t) (rng() % 1000);}},
+        {"exponential", [&]{return (std::int64_t) std::exp(std::uniform_real_distribution<double>(0, 40)(rng));}},
+    };
+
+    for(auto &[name, generate] : distributions){
+        std::vector<std::int64_t> arr(n);
+        for(auto &x : arr)
+            x = generate();
+        std::sort(arr.begin(), arr.end());
+
+        std::vector<std::pair<std::string, std::vector<std::int64_t>>> patterns(3);
+        patterns[0].first = "random";
+        patterns[1].first = "near front";
+        patterns[2].first = "increasing";
+        for(int i = 0; i < q; i++){
+            patterns[0].second.push_back(arr[rng() % n]);
+            patterns[1].second.push_back(arr[rng() % 64]);
+        }
+        for(int i = 0; i < q; i++)
+            patterns[2].second.push_back(arr[(std::size_t) i * (n / q)]);
+
+        for(auto &[pattern, queries] : patterns){
+            std::ptrdiff_t hint = 0;
+            std::vector<std::pair<std::string, double>> results = {
+                {"binary", measure(queries, [&](std::int64_t x){return binary_search(arr, x);})},
+                {"ternary", measure(queries, [&](std::int64_t x){return ternary_search(arr, x);})},
+                {"interpolation", measure(queries, [&](std::int64_t x){return interpolation_search(arr, x);})},
+                {"exponential", measure(queries, [&](std::int64_t x){
+                    std::ptrdiff_t res = exponential_search(arr, x, pattern == "increasing" ? hint : 0);
+                    hint = res == -1 ? hint : res;
+                    return res;
+                })},
+            };
+            std::cout << name << " keys, " << pattern << " queries:";
+            for(auto &[algorithm, time] : results)
+                std::cout << " " << algorithm << " " << time << " ns;";
+            auto best = std::min_element(results.begin(), results.end(), [](auto &a, auto &b){return a.second < b.second;});
+            std::cout << " best: " << best->first << std::endl;
+        }
+    }
+    return 0;
+}
@@ -0,0 +1,114 @@
+/****************************************************************
+ * @file
+ * @brief SIMD Search tests
+ * @details
+ * Checks every rank kernel and the k-ary search against std::lower_bound
+****************************************************************/
+
+#include <algorithm>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <vector>
+#include "simd_search.h"
+
+/****************************************************************
+ * @brief Compare kary_lower_bound with std::lower_bound on random sorted arrays
+ * @param max_n - largest array size
+ * @return true if all answers match
+ ****************************************************************/
+template <typename T>
+bool random_test(int max_n){
+    std::mt19937_64 rng(42);
+    for(int n = 0; n <= max_n; n += 1 + n / 8){
+        std::vector<T> arr(n);
+        for(auto &x : arr)
+            x = (T) (rng() % (2 * n + 1)) - n;
+        std::sort(arr.begin(), arr.end());
+        for(int q = 0; q < 200; q++){
+            T val = (T) (rng() % (2 * n + 3)) - n - 1;
+            std::size_t expected = std::lower_bound(arr.begin(), arr.end(), val) - arr.begin();
+            if(kary_lower_bound(arr.data(), arr.size(), val) != expected)
+                return false;
+        }
+    }
+    return true;
+}
+
+/****************************************************************
+ * @brief Compare a rank kernel with the scalar one
+ * @param level - instruction set to check
+ * @return true if all answers match
+ ****************************************************************/
+template <typename T>
+bool rank_test(SimdLevel level){
+    std::mt19937_64 rng(7);
+    auto rank = simd_rank_function<T>(level);
+    auto scalar = simd_rank_function<T>(SimdLevel::Scalar);
+    for(int n = 0; n <= 100; n++){
+        std::vector<T> arr(n);
+        for(auto &x : arr)
+            x = (T) (rng() % 64) - 32;
+        // unsigned keys wrap around, so both sides of the sign bit are checked
+        for(int v = -33; v <= 33; v++)
+            if(rank(arr.data(), n, (T) v) != scalar(arr.data(), n, (T) v))
+                return false;
+    }
+    return true;
+}
+
+int main(){
+    const char *names[] = {"scalar", "SSE4.2", "AVX2"};
+    std::cout << "Detected instruction set: " << names[(int) simd_level()] << std::endl;
+    std::cout << std::endl;
+
+    // region test 1
+    std::vector<int> arr = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10};
+    auto result = simd_search(arr, 5);
+    std::cout << "Test 1" << std::endl;
+    std::cout << "arr = {1, 2, 3, 4, 5, 6, 7, 8, 9, 10}" << std::endl;
+    std::cout << "simd_search(arr, 5) = " << result << std::endl;
+    std::cout << "correct answer = 4" << std::endl;
+    if(result == 4)
+        std::cout << "Test 1 passed" << std::endl;
+    else
+        std::cout << "Test 1 failed" << std::endl;
+    std::cout << std::endl;
+    // endregion
+
+    // region test 2
+    auto result2 = simd_search(arr, 11);
+    std::cout << "Test 2" << std::endl;
+    std::cout << "simd_search(arr, 11) = " << result2 << std::endl;
+    std::cout << "correct answer = -1" << std::endl;
+    if(result2 == -1)
+        std::cout << "Test 2 passed" << std::endl;
+    else
+        std::cout << "Test 2 failed" << std::endl;
+    std::cout << std::endl;
+    // endregion
+
+    // region test 3
+    bool ok = true;
+    for(auto level : {SimdLevel::Scalar, SimdLevel::SSE42, SimdLevel::AVX2})
+        ok = ok && rank_test<std::int32_t>(level) && rank_test<std::int64_t>(level)
+             && rank_test<std::uint32_t>(level) && rank_test<std::uint64_t>(level);
+    std::cout << "Test 3" << std::endl;
+    std::cout << "rank kernels match the scalar kernel" << std::endl;
+    if(ok)
+        std::cout << "Test 3 passed" << std::endl;
+    else
+        std::cout << "Test 3 failed" << std::endl;
+    std::cout << std::endl;
+    // endregion
+
+    // region random test
+    std::cout << "Random test" << std::endl;
+    if(random_test<std::int32_t>(5000) && random_test<std::int64_t>(5000) && random_test<std::uint32_t>(5000)
+       && random_test<std::uint64_t>(5000) && random_test<double>(1000))
+        std::cout << "Random test passed" << std::endl;
+    else
+        std::cout << "Random test failed" << std::endl;
+    // endregion
+    return 0;
+}
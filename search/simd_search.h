@@ -0,0 +1,312 @@
+/****************************************************************
+ * @file
+ * @brief SIMD Linear and K-ary Search Algorithm
+ * @details
+ * On small ranges a linear scan that compares many keys per instruction
+ * beats binary and ternary search: there are no dependent branches and the
+ * whole range is already in a few cache lines.
+ *
+ * simd_rank counts the elements less than a value, which for a sorted range
+ * is the position of the lower bound. It compares 16 keys per iteration
+ * with AVX2 or SSE4.2 for 32-bit and 64-bit integers, signed or unsigned:
+ * unsigned keys have their sign bit flipped, so signed compares give their
+ * order. Other keys are scanned without SIMD. The instruction set is
+ * picked once at runtime, so the same binary runs on machines without AVX2.
+ *
+ * K-ary search narrows a larger range with 16 pivots per step: the pivots
+ * are loaded independently, so their cache misses overlap, compared with one
+ * simd_rank call and the range shrinks 17 times.
+ * When the range is small enough it is finished with simd_rank.
+ *
+ * ### Complexity
+ *
+ * Rank : O(n / 16)
+ * K-ary search : O(log17 n)
+ * Space Complexity : O(1)
+****************************************************************/
+
+#pragma once
+
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SIMD_SEARCH_X86 1
+#include <immintrin.h>
+#endif
+
+/// instruction sets used by simd_rank
+enum class SimdLevel{
+    Scalar,
+    SSE42,
+    AVX2
+};
+
+namespace simd_search_detail{
+    template <typename T>
+    constexpr bool is_simd_key = std::is_same_v<T, std::int32_t> || std::is_same_v<T, std::int64_t>
+            || std::is_same_v<T, std::uint32_t> || std::is_same_v<T, std::uint64_t>;
+
+    template <typename T>
+    using rank_function = std::size_t (*)(const T *, std::size_t, T);
+
+    /**
+     * @brief Count elements less than val without SIMD
+     */
+    template <typename T>
+    std::size_t rank_scalar(const T *arr, std::size_t n, T val){
+        std::size_t res = 0;
+        for(std::size_t i = 0; i < n; i++)
+            res += arr[i] < val;
+        return res;
+    }
+
+    /**
+     * @brief Compare signed keys, as unsigned ones if FLIP
+     */
+    template <bool FLIP, typename S>
+    bool less_key(S a, S b){
+        if constexpr(FLIP)
+            return (std::make_unsigned_t<S>) a < (std::make_unsigned_t<S>) b;
+        else
+            return a < b;
+    }
+
+#ifdef SIMD_SEARCH_X86
+    /**
+     * @brief Count 32-bit elements less than val, 16 per iteration with AVX2
+     * @details with FLIP the keys are unsigned: the sign bit is flipped, so signed compares give their order
+     */
+    template <bool FLIP = false>
+    __attribute__((target("avx2,popcnt")))
+    std::size_t rank_avx2(const std::int32_t *arr, std::size_t n, std::int32_t val){
+        const __m256i sign = _mm256_set1_epi32(FLIP ? INT32_MIN : 0);
+        __m256i x = _mm256_set1_epi32(FLIP ? (val ^ INT32_MIN) : val);
+        std::size_t res = 0, i = 0;
+        for(; i + 16 <= n; i += 16){
+            __m256i a = _mm256_loadu_si256((const __m256i *) (arr + i));
+            if constexpr(FLIP)
+                a = _mm256_xor_si256(a, sign);
+            __m256i b = _mm256_loadu_si256((const __m256i *) (arr + i + 8));
+            if constexpr(FLIP)
+                b = _mm256_xor_si256(b, sign);
+            unsigned mask = _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(x, a)))
+                    | _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(x, b))) << 8;
+            res += std::popcount(mask);
+        }
+        for(; i + 8 <= n; i += 8){
+            __m256i a = _mm256_loadu_si256((const __m256i *) (arr + i));
+            if constexpr(FLIP)
+                a = _mm256_xor_si256(a, sign);
+            res += std::popcount((unsigned) _mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpgt_epi32(x, a))));
+        }
+        for(; i < n; i++)
+            res += less_key<FLIP>(arr[i], val);
+        return res;
+    }
+
+    /**
+     * @brief Count 64-bit elements less than val, 16 per iteration with AVX2
+     */
+    template <bool FLIP = false>
+    __attribute__((target("avx2,popcnt")))
+    std::size_t rank_avx2(const std::int64_t *arr, std::size_t n, std::int64_t val){
+        const __m256i sign = _mm256_set1_epi64x(FLIP ? INT64_MIN : 0);
+        __m256i x = _mm256_set1_epi64x(FLIP ? (val ^ INT64_MIN) : val);
+        std::size_t res = 0, i = 0;
+        for(; i + 16 <= n; i += 16){
+            unsigned mask = 0;
+            for(int j = 0; j < 4; j++){
+                __m256i a = _mm256_loadu_si256((const __m256i *) (arr + i + 4 * j));
+                if constexpr(FLIP)
+                    a = _mm256_xor_si256(a, sign);
+                mask |= _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(x, a))) << (4 * j);
+            }
+            res += std::popcount(mask);
+        }
+        for(; i + 4 <= n; i += 4){
+            __m256i a = _mm256_loadu_si256((const __m256i *) (arr + i));
+            if constexpr(FLIP)
+                a = _mm256_xor_si256(a, sign);
+            res += std::popcount((unsigned) _mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpgt_epi64(x, a))));
+        }
+        for(; i < n; i++)
+            res += less_key<FLIP>(arr[i], val);
+        return res;
+    }
+
+    /**
+     * @brief Count 32-bit elements less than val, 16 per iteration with SSE4.2
+     */
+    template <bool FLIP = false>
+    __attribute__((target("sse4.2,popcnt")))
+    std::size_t rank_sse42(const std::int32_t *arr, std::size_t n, std::int32_t val){
+        const __m128i sign = _mm_set1_epi32(FLIP ? INT32_MIN : 0);
+        __m128i x = _mm_set1_epi32(FLIP ? (val ^ INT32_MIN) : val);
+        std::size_t res = 0, i = 0;
+        for(; i + 16 <= n; i += 16){
+            unsigned mask = 0;
+            for(int j = 0; j < 4; j++){
+                __m128i a = _mm_loadu_si128((const __m128i *) (arr + i + 4 * j));
+                if constexpr(FLIP)
+                    a = _mm_xor_si128(a, sign);
+                mask |= _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(x, a))) << (4 * j);
+            }
+            res += std::popcount(mask);
+        }
+        for(; i + 4 <= n; i += 4){
+            __m128i a = _mm_loadu_si128((const __m128i *) (arr + i));
+            if constexpr(FLIP)
+                a = _mm_xor_si128(a, sign);
+            res += std::popcount((unsigned) _mm_movemask_ps(_mm_castsi128_ps(_mm_cmpgt_epi32(x, a))));
+        }
+        for(; i < n; i++)
+            res += less_key<FLIP>(arr[i], val);
+        return res;
+    }
+
+    /**
+     * @brief Count 64-bit elements less than val, 16 per iteration with SSE4.2
+     */
+    template <bool FLIP = false>
+    __attribute__((target("sse4.2,popcnt")))
+    std::size_t rank_sse42(const std::int64_t *arr, std::size_t n, std::int64_t val){
+        const __m128i sign = _mm_set1_epi64x(FLIP ? INT64_MIN : 0);
+        __m128i x = _mm_set1_epi64x(FLIP ? (val ^ INT64_MIN) : val);
+        std::size_t res = 0, i = 0;
+        for(; i + 16 <= n; i += 16){
+            unsigned mask = 0;
+            for(int j = 0; j < 8; j++){
+                __m128i a = _mm_loadu_si128((const __m128i *) (arr + i + 2 * j));
+                if constexpr(FLIP)
+                    a = _mm_xor_si128(a, sign);
+                mask |= _mm_movemask_pd(_mm_castsi128_pd(_mm_cmpgt_epi64(x, a))) << (2 * j);
+            }
+            res += std::popcount(mask);
+        }
+        for(; i + 2 <= n; i += 2){
+            __m128i a = _mm_loadu_si128((const __m128i *) (arr + i));
+            if constexpr(FLIP)
+                a = _mm_xor_si128(a, sign);
+            res += std::popcount((unsigned) _mm_movemask_pd(_mm_castsi128_pd(_mm_cmpgt_epi64(x, a))));
+        }
+        for(; i < n; i++)
+            res += less_key<FLIP>(arr[i], val);
+        return res;
+    }
+
+    /**
+     * @brief Count unsigned elements less than val with a kernel of the signed type of the same width
+     */
+    template <typename T, SimdLevel LEVEL>
+    std::size_t rank_unsigned(const T *arr, std::size_t n, T val){
+        using S = std::make_signed_t<T>;
+        if constexpr(LEVEL == SimdLevel::AVX2)
+            return rank_avx2<true>(reinterpret_cast<const S *>(arr), n, (S) val);
+        else
+            return rank_sse42<true>(reinterpret_cast<const S *>(arr), n, (S) val);
+    }
+#endif
+}
+
+/****************************************************************
+ * @brief Get the best instruction set supported by this CPU
+ * @return detected instruction set
+ ****************************************************************/
+inline SimdLevel simd_level(){
+#ifdef SIMD_SEARCH_X86
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx2") && __builtin_cpu_supports("popcnt"))
+        return SimdLevel::AVX2;
+    if(__builtin_cpu_supports("sse4.2") && __builtin_cpu_supports("popcnt"))
+        return SimdLevel::SSE42;
+#endif
+    return SimdLevel::Scalar;
+}
+
+/****************************************************************
+ * @brief Get the rank kernel for an instruction set
+ * @param level - instruction set, falls back to scalar code if it is not supported
+ * @return function counting elements less than a value
+ ****************************************************************/
+template <typename T>
+simd_search_detail::rank_function<T> simd_rank_function(SimdLevel level){
+#ifdef SIMD_SEARCH_X86
+    if constexpr(simd_search_detail::is_simd_key<T>){
+        if(level > simd_level())
+            level = simd_level();
+        using namespace simd_search_detail;
+        if constexpr(std::is_unsigned_v<T>){
+            if(level == SimdLevel::AVX2)
+                return rank_unsigned<T, SimdLevel::AVX2>;
+            if(level == SimdLevel::SSE42)
+                return rank_unsigned<T, SimdLevel::SSE42>;
+        }else{
+            if(level == SimdLevel::AVX2)
+                return rank_avx2<>;
+            if(level == SimdLevel::SSE42)
+                return rank_sse42<>;
+        }
+    }
+#endif
+    return simd_search_detail::rank_scalar<T>;
+}
+
+/****************************************************************
+ * @brief Count elements less than val
+ * @param arr - array to search in
+ * @param n - number of elements
+ * @param val - value to compare with
+ * @return number of elements less than val, the lower bound if arr is sorted
+ ****************************************************************/
+template <typename T>
+std::size_t simd_rank(const T *arr, std::size_t n, const T &val){
+    if constexpr(simd_search_detail::is_simd_key<T>){
+        static const simd_search_detail::rank_function<T> rank = simd_rank_function<T>(simd_level());
+        return rank(arr, n, val);
+    }
+    else
+        return simd_search_detail::rank_scalar<T>(arr, n, val);
+}
+
+/****************************************************************
+ * @brief K-ary search for the first element not less than val
+ * @param arr - sorted array to search in
+ * @param n - number of elements
+ * @param val - value to search
+ * @return position of the lower bound, n if every element is less than val
+ ****************************************************************/
+template <typename T>
+std::size_t kary_lower_bound(const T *arr, std::size_t n, const T &val){
+    constexpr std::size_t K = 16;  // pivots per step
+    constexpr std::size_t LINEAR = 4 * K;  // ranges up to this size are scanned
+    std::size_t left = 0, len = n;
+    T pivots[K];
+    while(len > LINEAR){
+        std::size_t step = len / (K + 1);
+        // pivot i closes segment i, the lower bound is inside the segment of the first pivot not less than val
+        for(std::size_t i = 0; i < K; i++)
+            pivots[i] = arr[left + (i + 1) * step - 1];
+        std::size_t r = simd_rank(pivots, K, val);
+        left += r * step;
+        len = r == K ? len - K * step : step;
+    }
+    return left + simd_rank(arr + left, len, val);
+}
+
+/****************************************************************
+ * @brief SIMD k-ary search algorithm
+ * @param arr - sorted array to search in
+ * @param val - value to search
+ * @return index of key in array or -1 if not found
+ ****************************************************************/
+template <typename T>
+std::ptrdiff_t simd_search(const std::vector<T> &arr, const T &val){
+    std::size_t i = kary_lower_bound(arr.data(), arr.size(), val);
+    if(i == arr.size() || !(arr[i] == val))
+        return -1;
+    return (std::ptrdiff_t) i;
+}
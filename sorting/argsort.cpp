@@ -0,0 +1,165 @@
+/****************************************************************
+ * @file
+ * @brief Argsort and Sort by Key tests and benchmark
+ * @details
+ * Checks argsort and sort_by_key against std::stable_sort and compares
+ * bytes moved and time with sorting 200-byte records directly
+****************************************************************/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <iostream>
+#include <numeric>
+#include <random>
+#include <string>
+#include <vector>
+#include "argsort.h"
+
+/**
+ * @brief 200-byte record sorted by an 8-byte key
+ */
+struct Record {
+    std::uint64_t key;
+    char payload[192];
+};
+
+/**
+ * @brief Record that counts how many times records are moved or copied
+ */
+struct CountedRecord {
+    static inline long long moves = 0;
+    std::uint64_t key = 0;
+    char payload[192] = {};
+
+    CountedRecord() = default;
+    CountedRecord(const CountedRecord &other) : key(other.key) {moves++;}
+    CountedRecord &operator=(const CountedRecord &other) {
+        key = other.key;
+        moves++;
+        return *this;
+    }
+};
+
+/****************************************************************
+ * @brief Measure running time
+ * @param arr - input array, copied
+ * @param run - function to measure
+ * @return milliseconds
+ ****************************************************************/
+template <typename T, typename F>
+double measure(std::vector<T> arr, F run) {
+    auto start = std::chrono::steady_clock::now();
+    run(arr);
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+int main() {
+    // region test 1
+    std::vector<int> v1({30, 10, 50, 20, 40});
+    for (auto i: argsort(v1, std::less<>()))
+        std::cout << i << " ";
+    std::cout << std::endl;
+    // endregion
+
+    // region test 2
+    std::vector<std::string> v2({"abc", "a", "aaa", "zxc"});
+    sort_by_key(v2, std::greater<>(), [](const std::string &s) {return s.size();});
+    for (auto i: v2)
+        std::cout << i << " ";
+    std::cout << std::endl;
+    // endregion
+
+    // region test 3
+    std::vector<int> v3;
+    sort_by_key(v3, std::less<>());
+    // endregion
+
+    // region test 4
+    // -0.0 and 0.0 are equal keys and keep their order
+    std::vector<float> v4({0.0f, -0.0f, 1.0f});
+    for (auto i: argsort(v4, std::less<>()))
+        std::cout << i << " ";
+    std::cout << "correct answer: 0 1 2" << std::endl;
+    // endregion
+
+    // region test 5
+    // long double keys are sorted by comparison
+    std::vector<long double> v5({2.5L, -1.0L, 2.5L, 0.0L});
+    for (auto i: argsort(v5, std::less<>()))
+        std::cout << i << " ";
+    std::cout << "correct answer: 1 3 0 2" << std::endl;
+    // endregion
+
+    // region random test
+    std::mt19937_64 rng(42);
+    bool ok = true;
+    for (int n = 0; n <= 20000 && ok; n += 1 + n / 2) {
+        for (std::uint64_t range : {std::uint64_t(2), std::uint64_t(100), UINT64_MAX}) {
+            std::vector<std::pair<std::uint64_t, int>> arr(n);
+            for (int i = 0; i < n; i++)
+                arr[i] = {rng() % range, i};
+            std::vector<std::pair<std::uint64_t, int>> expected = arr;
+            std::stable_sort(expected.begin(), expected.end(), [](auto &a, auto &b) {return a.first < b.first;});
+            std::vector<std::pair<std::uint64_t, int>> by_radix = arr, by_comparison = arr;
+            // pointer to member as projection, radix sort path
+            sort_by_key(by_radix, std::less<>(), &std::pair<std::uint64_t, int>::first);
+            ok = ok && by_radix == expected;
+            // comparison path
+            sort_by_key(by_comparison, [](std::uint64_t a, std::uint64_t b) {return a < b;},
+                        [](const std::pair<std::uint64_t, int> &p) {return p.first;});
+            ok = ok && by_comparison == expected;
+            std::vector<std::size_t> perm = argsort(arr, std::less<>(), &std::pair<std::uint64_t, int>::first);
+            for (int i = 0; i < n && ok; i++)
+                ok = arr[perm[i]] == expected[i];
+        }
+    }
+    std::cout << "Random test" << std::endl;
+    if (ok)
+        std::cout << "Random test passed" << std::endl;
+    else
+        std::cout << "Random test failed" << std::endl;
+    std::cout << std::endl;
+    // endregion
+
+    // region memory traffic
+    std::size_t n = 1 << 20;
+    std::vector<CountedRecord> counted(n);
+    for (auto &r : counted)
+        r.key = rng();
+    auto counted_key = [](const CountedRecord &a, const CountedRecord &b) {return a.key < b.key;};
+    std::cout << "Records moved or copied for " << n << " records of " << sizeof(Record) << " bytes" << std::endl;
+    CountedRecord::moves = 0;
+    measure(counted, [&](std::vector<CountedRecord> &a) {pdq_sort(a, counted_key);});
+    std::cout << "pdq_sort: " << CountedRecord::moves - (long long) n << " moves, "
+              << (CountedRecord::moves - (long long) n) * (long long) sizeof(Record) / (1 << 20) << " MiB" << std::endl;
+    CountedRecord::moves = 0;
+    measure(counted, [](std::vector<CountedRecord> &a) {sort_by_key(a, std::less<>(), &CountedRecord::key);});
+    std::cout << "sort_by_key: " << CountedRecord::moves - (long long) n << " moves, "
+              << (CountedRecord::moves - (long long) n) * (long long) sizeof(Record) / (1 << 20) << " MiB" << std::endl;
+    // endregion
+
+    // region benchmark
+    std::vector<Record> records(n);
+    for (std::size_t i = 0; i < n; i++) {
+        records[i].key = rng();
+        std::fill(std::begin(records[i].payload), std::end(records[i].payload), (char) i);
+    }
+    auto by_key = [](const Record &a, const Record &b) {return a.key < b.key;};
+    std::cout << "Benchmark on " << n << " records" << std::endl;
+    std::cout << "pdq_sort: " << measure(records, [&](std::vector<Record> &a) {pdq_sort(a, by_key);}) << " ms"
+              << std::endl;
+    std::cout << "std::sort: " << measure(records, [&](std::vector<Record> &a) {
+        std::sort(a.begin(), a.end(), by_key);
+    }) << " ms" << std::endl;
+    std::cout << "sort_by_key: " << measure(records, [](std::vector<Record> &a) {
+        sort_by_key(a, std::less<>(), &Record::key);
+    }) << " ms" << std::endl;
+    std::cout << "argsort: " << measure(records, [](std::vector<Record> &a) {
+        argsort(a, std::less<>(), &Record::key);
+    }) << " ms" << std::endl;
+    // endregion
+    return 0;
+}
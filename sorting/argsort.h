@@ -0,0 +1,100 @@
+/****************************************************************
+ * @file
+ * @brief Argsort and Sort by Key Algorithms
+ * @details
+ * Sorting large records by a small key moves the whole record on every
+ * swap. These functions sort (key, index) pairs instead:
+ * 1) argsort returns the permutation that sorts the array and does not
+ * touch the array. Keys are pulled out by a projection, which is any
+ * callable or a pointer to member. Integer, float and double keys compared
+ * with std::less are sorted with radix_sort, -0.0 is mapped to 0.0 so they
+ * stay equal. Other keys are sorted with pdq_sort and ties broken by index,
+ * so equal keys keep their order either way.
+ * 2) apply_permutation moves every element once, following the cycles of
+ * the permutation in place.
+ * 3) sort_by_key is argsort followed by apply_permutation: a record is
+ * moved once instead of O(log n) times.
+ *
+ * ### Complexity
+ * Sort :  O(n log n) on pairs, O(n) record moves
+ * Space Complexity : O(n) for the pairs and the permutation
+****************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "pdq_sort.h"
+#include "radix_sort.h"
+
+/****************************************************************
+ * @brief Argsort algorithm
+ * @param arr - array to sort
+ * @param func - comparison function of keys, true if the first argument goes before the second
+ * @param proj - projection, returns the key of an element
+ * @returns perm such that arr[perm[0]], arr[perm[1]], ... is sorted, equal keys keep their order
+ ****************************************************************/
+template <typename T, typename Compare, typename Projection = std::identity>
+std::vector<std::size_t> argsort(const std::vector<T> &arr, Compare func, Projection proj = {}) {
+    using K = std::decay_t<std::invoke_result_t<Projection &, const T &>>;
+    std::vector<std::pair<K, std::size_t>> pairs(arr.size());
+    for (std::size_t i = 0; i < arr.size(); i++)
+        pairs[i] = {std::invoke(proj, arr[i]), i};
+    constexpr bool radix_key = std::is_integral_v<K> || std::is_same_v<K, float> || std::is_same_v<K, double>;
+    if constexpr (radix_key && (std::is_same_v<Compare, std::less<>> || std::is_same_v<Compare, std::less<K>>))
+        radix_sort(pairs, [](const std::pair<K, std::size_t> &p) {
+            if constexpr (std::is_floating_point_v<K>)
+                return p.first == 0 ? K(0) : p.first;  // -0.0 and 0.0 are equal for std::less
+            else
+                return p.first;
+        });
+    else
+        pdq_sort(pairs, [&func](const std::pair<K, std::size_t> &a, const std::pair<K, std::size_t> &b) {
+            if (func(a.first, b.first))
+                return true;
+            return !func(b.first, a.first) && a.second < b.second;
+        });
+    std::vector<std::size_t> perm(arr.size());
+    for (std::size_t i = 0; i < arr.size(); i++)
+        perm[i] = pairs[i].second;
+    return perm;
+}
+
+/****************************************************************
+ * @brief Reorder an array by a permutation in place
+ * @param arr - array to reorder, receives arr[perm[0]], arr[perm[1]], ...
+ * @param perm - permutation, consumed: it is the identity afterwards
+ ****************************************************************/
+template <typename T>
+void apply_permutation(std::vector<T> &arr, std::vector<std::size_t> &perm) {
+    for (std::size_t i = 0; i < arr.size(); i++) {
+        if (perm[i] == i)
+            continue;
+        // rotate the cycle through i, visited positions are marked as fixed points
+        T tmp = std::move(arr[i]);
+        std::size_t j = i;
+        while (perm[j] != i) {
+            std::size_t next = perm[j];
+            arr[j] = std::move(arr[next]);
+            perm[j] = j;
+            j = next;
+        }
+        arr[j] = std::move(tmp);
+        perm[j] = j;
+    }
+}
+
+/****************************************************************
+ * @brief Sort by Key algorithm, stable
+ * @param arr - array to sort
+ * @param func - comparison function of keys, true if the first argument goes before the second
+ * @param proj - projection, returns the key of an element
+ ****************************************************************/
+template <typename T, typename Compare, typename Projection = std::identity>
+void sort_by_key(std::vector<T> &arr, Compare func, Projection proj = {}) {
+    std::vector<std::size_t> perm = argsort(arr, func, proj);
+    apply_permutation(arr, perm);
+}
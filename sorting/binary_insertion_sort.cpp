@@ -0,0 +1,99 @@
+/****************************************************************
+ * @file
+ * @brief Binary Insertion Sort tests
+ * @details
+ * Also counts the comparisons made by insertion_sort and binary_insertion_sort
+****************************************************************/
+
+#include <algorithm>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "binary_insertion_sort.h"
+#include "insertion_sort.h"
+
+template <typename T>
+bool comp(T a, T b) {return a > b;}
+
+int main() {
+    // region test 1
+    std::vector<int> v1({5, 4, 3, 2, 1});
+    for (auto i: v1)
+        std::cout << i << " ";
+    std::cout << std::endl;
+    binary_insertion_sort(v1, comp);
+    for (auto i: v1)
+        std::cout << i << " ";
+    std::cout << std::endl;
+    // endregion
+
+    // region test 2
+    std::vector<int> v2;
+    binary_insertion_sort(v2, comp);
+    // endregion
+
+    // region test 3
+    std::vector<double> v3({1.1, -3.5, 2.3, 1123.3});
+    for (auto i: v3)
+        std::cout << i << " ";
+    std::cout << std::endl;
+    binary_insertion_sort(v3, comp);
+    for (auto i: v3)
+        std::cout << i << " ";
+    std::cout << std::endl;
+    // endregion
+
+    // region test 4
+    std::vector<std::string> v4({"abc", "a", "aaa", "zxc"});
+    for (auto i: v4)
+        std::cout << i << " ";
+    std::cout << std::endl;
+    binary_insertion_sort(v4, comp);
+    for (auto i: v4)
+        std::cout << i << " ";
+    std::cout << std::endl;
+    // endregion
+
+    // region random test
+    std::mt19937 rng(42);
+    bool ok = true;
+    for (int n = 0; n <= 300 && ok; n++) {
+        std::vector<std::pair<int, int>> arr(n);
+        for (int i = 0; i < n; i++)
+            arr[i] = {(int) (rng() % 10), i};
+        auto by_key = [](const std::pair<int, int> &a, const std::pair<int, int> &b) {return a.first < b.first;};
+        std::vector<std::pair<int, int>> expected = arr;
+        std::stable_sort(expected.begin(), expected.end(), by_key);
+        binary_insertion_sort(arr, by_key);
+        ok = arr == expected;
+    }
+    std::cout << "Random test" << std::endl;
+    if (ok)
+        std::cout << "Random test passed" << std::endl;
+    else
+        std::cout << "Random test failed" << std::endl;
+    std::cout << std::endl;
+    // endregion
+
+    // region comparisons
+    std::vector<std::string> strings(1000);
+    for (auto &s : strings)
+        s = "log line " + std::to_string(rng());
+    for (bool binary : {false, true}) {
+        std::vector<std::string> arr = strings;
+        long long comparisons = 0;
+        auto counting = [&comparisons](const std::string &a, const std::string &b) {
+            comparisons++;
+            return a < b;
+        };
+        if (binary)
+            binary_insertion_sort(arr, counting);
+        else
+            insertion_sort(arr, counting);
+        std::cout << (binary ? "binary_insertion_sort: " : "insertion_sort: ") << comparisons
+                  << " comparisons on " << arr.size() << " strings" << std::endl;
+    }
+    // endregion
+    return 0;
+}
@@ -0,0 +1,75 @@
+/****************************************************************
+ * @file
+ * @brief Binary Insertion Sort Algorithm
+ * @details
+ * Binary insertion sort is insertion sort that finds the place of every
+ * element with binary search in the sorted prefix, then shifts the tail of
+ * the prefix with one move. It makes O(n log n) comparisons instead of
+ * O(n^2), which pays off when comparisons are expensive (strings, records).
+ * Moves are still O(n^2). It is stable.
+ *
+ * ### Complexity
+ * Sort :  O(n^2), O(n log n) comparisons
+ * Space Complexity : O(1)
+****************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+/****************************************************************
+ * @brief Binary Insertion Sort algorithm on a range with a sorted prefix
+ * @param arr - array to sort
+ * @param left - first index of the range
+ * @param start - first index after the sorted prefix of the range
+ * @param right - index after the last one of the range
+ * @param func - comparison function, true if the first argument goes before the second
+ ****************************************************************/
+template <typename T, typename Compare>
+void binary_insertion_sort(std::vector<T> &arr, std::size_t left, std::size_t start, std::size_t right,
+                           Compare func) {
+    for (std::size_t i = std::max(start, left + 1); i < right; i++) {
+        // after the elements equal to key, so the sort is stable
+        auto pos = std::upper_bound(arr.begin() + left, arr.begin() + i, arr[i], func);
+        if (pos == arr.begin() + i)
+            continue;
+        T key = std::move(arr[i]);
+        std::move_backward(pos, arr.begin() + i, arr.begin() + i + 1);
+        *pos = std::move(key);
+    }
+}
+
+/****************************************************************
+ * @brief Binary Insertion Sort algorithm on a range
+ * @param arr - array to sort
+ * @param left - first index of the range
+ * @param right - index after the last one of the range
+ * @param func - comparison function, true if the first argument goes before the second
+ ****************************************************************/
+template <typename T, typename Compare>
+void binary_insertion_sort(std::vector<T> &arr, std::size_t left, std::size_t right, Compare func) {
+    binary_insertion_sort(arr, left, left + 1, right, func);
+}
+
+/****************************************************************
+ * @brief Binary Insertion Sort algorithm
+ * @param arr - array to sort
+ * @param func - comparison function, true if the first argument goes before the second
+ ****************************************************************/
+template <typename T, typename Compare>
+void binary_insertion_sort(std::vector<T> &arr, Compare func) {
+    binary_insertion_sort(arr, 0, arr.size(), func);
+}
+
+/****************************************************************
+ * @brief Binary Insertion Sort algorithm
+ * @param arr - array to sort
+ * @param func - comparison function, true if the first argument goes before the second
+ ****************************************************************/
+template <typename T>
+void binary_insertion_sort(std::vector<T> &arr, bool (*func)(T, T)) {
+    binary_insertion_sort<T, bool (*)(T, T)>(arr, 0, arr.size(), func);
+}
@@ -0,0 +1,33 @@
+/****************************************************************
+ * @file
+ * @brief Bubble Sort Algorithm
+ * @details
+ * Bubble Sort is the simplest sorting algorithm that works by repeatedly
+ * swapping the adjacent elements if they are in wrong order
+ *
+ * ### Complexity
+ * Sort :  O(n^2)
+ * Space Complexity : O(1)
+****************************************************************/
+
+#pragma once
+
+#include <utility>
+#include <vector>
+
+/****************************************************************
+ * @brief Bubble Sort algorithm
+ * @param arr - array to sort
+ * @param func - comparison function
+ ****************************************************************/
+template <typename T>
+void bubble_sort(std::vector<T> &arr, bool (*func)(T, T)) {
+    int n = arr.size();
+    for (int i = 0; i < n - 1; i++) {
+        for (int j = 0; j < n - i - 1; j++) {
+            if (!func(arr[j], arr[j + 1])) {
+                std::swap(arr[j], arr[j + 1]);
+            }
+        }
+    }
+}
@@ -0,0 +1,154 @@
+/****************************************************************
+ * @file
+ * @brief External Merge Sort tests and benchmark
+ * @details
+ * Sorts binary files of records under memory limits that force one or
+ * several merge passes, checks the result and reports runs and I/O volume
+****************************************************************/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <stdexcept>
+#include <vector>
+#include "external_sort.h"
+
+/**
+ * @brief 32-byte record sorted by key
+ */
+struct Record {
+    std::uint64_t key;
+    std::uint64_t payload[3];
+};
+
+/**
+ * @brief Write random records to a file
+ * @returns records written
+ */
+std::vector<Record> write_records(const std::filesystem::path &path, std::size_t n, std::uint64_t range,
+                                  std::mt19937_64 &rng) {
+    std::vector<Record> records(n);
+    for (std::size_t i = 0; i < n; i++)
+        records[i] = {rng() % range, {i, rng(), rng()}};
+    std::ofstream file(path, std::ios::binary);
+    file.write(reinterpret_cast<const char *>(records.data()), (std::streamsize) (n * sizeof(Record)));
+    return records;
+}
+
+/**
+ * @brief Read all records of a file
+ */
+std::vector<Record> read_records(const std::filesystem::path &path) {
+    std::vector<Record> records(std::filesystem::file_size(path) / sizeof(Record));
+    std::ifstream file(path, std::ios::binary);
+    file.read(reinterpret_cast<char *>(records.data()), (std::streamsize) (records.size() * sizeof(Record)));
+    return records;
+}
+
+void print_stats(const ExternalSortStats &stats) {
+    std::cout << stats.records << " records, " << stats.runs << " runs, " << stats.merge_passes
+              << " merge passes, " << stats.bytes_read / (1 << 20) << " MiB read, "
+              << stats.bytes_written / (1 << 20) << " MiB written" << std::endl;
+}
+
+int main() {
+    std::filesystem::path dir = std::filesystem::temp_directory_path();
+    std::filesystem::path input = dir / "external_sort_input.bin", output = dir / "external_sort_output.bin";
+    auto by_key = [](const Record &a, const Record &b) {return a.key < b.key;};
+    std::mt19937_64 rng(42);
+
+    // region test 1
+    std::vector<std::uint64_t> v1({5, 4, 3, 2, 1});
+    {
+        std::ofstream file(input, std::ios::binary);
+        file.write(reinterpret_cast<const char *>(v1.data()), (std::streamsize) (v1.size() * sizeof(std::uint64_t)));
+    }
+    external_sort<std::uint64_t>(input, output, 1 << 20);
+    std::ifstream file(output, std::ios::binary);
+    std::uint64_t x;
+    while (file.read(reinterpret_cast<char *>(&x), sizeof(x)))
+        std::cout << x << " ";
+    std::cout << std::endl;
+    // endregion
+
+    // region test 2
+    // a comparator that throws in the merge, no runs may be left behind
+    std::filesystem::path runs_dir = dir / "external_sort_runs";
+    std::filesystem::create_directories(runs_dir);
+    write_records(input, 100000, 1 << 30, rng);
+    std::size_t calls = 0, limit = SIZE_MAX;
+    auto throwing = [&](const Record &a, const Record &b) {
+        if (++calls > limit)
+            throw std::runtime_error("Comparator failed");
+        return a.key < b.key;
+    };
+    // the merge makes the last comparisons
+    external_sort<Record>(input, output, throwing, 1 << 18, runs_dir);
+    limit = calls * 9 / 10;
+    calls = 0;
+    try {
+        external_sort<Record>(input, output, throwing, 1 << 18, runs_dir);
+        std::cout << "No exception" << std::endl;
+    }
+    catch (const std::runtime_error &e) {
+        std::cout << e.what() << std::endl;
+    }
+    std::cout << "Runs left: " << std::distance(std::filesystem::directory_iterator(runs_dir),
+                                                std::filesystem::directory_iterator())
+              << ", correct answer: 0" << std::endl;
+    std::filesystem::remove(runs_dir);
+    std::cout << std::endl;
+    // endregion
+
+    // region random test
+    bool ok = true;
+    struct Case {
+        std::size_t n;
+        std::uint64_t range;
+        std::size_t memory;
+    };
+    for (Case c : std::vector<Case>{{0, 10, 1 << 20}, {1000, 10, 1 << 20}, {100000, 1 << 30, 1 << 20},
+                                    {100000, 100, 1 << 18}, {300000, 1ull << 60, 1 << 18}}) {
+        std::vector<Record> records = write_records(input, c.n, c.range, rng);
+        ExternalSortStats stats = external_sort<Record>(input, output, by_key, c.memory);
+        std::vector<Record> sorted = read_records(output);
+        ok = ok && stats.records == c.n && sorted.size() == c.n
+             && std::is_sorted(sorted.begin(), sorted.end(), by_key);
+        // every record is in the output once
+        auto by_index = [](const Record &a, const Record &b) {return a.payload[0] < b.payload[0];};
+        std::sort(sorted.begin(), sorted.end(), by_index);
+        for (std::size_t i = 0; i < c.n && ok; i++)
+            ok = sorted[i].key == records[i].key && sorted[i].payload[2] == records[i].payload[2];
+        print_stats(stats);
+    }
+    std::cout << "Random test" << std::endl;
+    if (ok)
+        std::cout << "Random test passed" << std::endl;
+    else
+        std::cout << "Random test failed" << std::endl;
+    std::cout << std::endl;
+    // endregion
+
+    // region benchmark
+    std::size_t n = 1 << 22;
+    write_records(input, n, UINT64_MAX, rng);
+    std::cout << "Benchmark on " << n * sizeof(Record) / (1 << 20) << " MiB of records" << std::endl;
+    for (std::size_t memory : {std::size_t(256) << 20, std::size_t(16) << 20, std::size_t(1) << 20}) {
+        auto start = std::chrono::steady_clock::now();
+        ExternalSortStats stats = external_sort<Record>(input, output, by_key, memory);
+        auto end = std::chrono::steady_clock::now();
+        std::cout << "memory " << memory / (1 << 20) << " MiB: "
+                  << std::chrono::duration<double, std::milli>(end - start).count() << " ms, ";
+        print_stats(stats);
+    }
+    // endregion
+
+    std::filesystem::remove(input);
+    std::filesystem::remove(output);
+    return 0;
+}
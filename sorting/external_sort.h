@@ -0,0 +1,438 @@
+/****************************************************************
+ * @file
+ * @brief External Merge Sort Algorithm
+ * @details
+ * Sorts a binary file of fixed-size records that does not fit in memory:
+ * 1) The input is read in chunks of half the memory limit, every chunk is
+ * sorted with pdq_sort and written to a temporary file as a run. The next
+ * chunk is read while the current one is sorted and written.
+ * 2) Runs are merged k at a time with a loser tree: the tree keeps the loser
+ * of every match, so replacing the winner replays only one leaf-to-root path
+ * with log k comparisons. If there are more runs than memory allows to merge
+ * at once, merging takes several passes.
+ * 3) Every run and the output have two blocks: one is consumed or filled by
+ * the merge while the other one is read or written in the background.
+ * Temporary runs are removed when the sort ends, also when it throws.
+ *
+ * Records are copied as raw bytes, so T must be trivially copyable.
+ *
+ * ### Complexity
+ * Sort :  O(n log n) comparisons
+ * I/O :  2 * n * (1 + passes) records, passes = ceil(log_k runs)
+ * Space Complexity : O(memory) in RAM, O(n) on disk
+****************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <functional>
+#include <future>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "pdq_sort.h"
+
+/**
+ * @brief Statistics of an external sort
+ */
+struct ExternalSortStats {
+    std::uintmax_t records = 0;  // records in the input
+    std::size_t runs = 0;  // sorted runs written by the first phase
+    std::size_t merge_passes = 0;  // passes over the data after the first phase
+    std::uintmax_t bytes_read = 0;
+    std::uintmax_t bytes_written = 0;
+};
+
+namespace external_sort_detail {
+    constexpr std::size_t MIN_BLOCK_BYTES = 1 << 16;  // smallest I/O block of a merge
+
+    /**
+     * @brief Tournament tree that keeps the loser of every match
+     * @details beats(a, b) tells if source a goes before source b
+     */
+    template <typename Beats>
+    class LoserTree {
+        std::vector<std::size_t> tree;  // tree[0] is the winner, tree[1..k-1] are losers of inner nodes
+        std::size_t k;
+        Beats beats;
+
+        /**
+         * @brief Play all matches of a subtree
+         * @returns winner of the subtree
+         */
+        std::size_t build(std::size_t node) {
+            if (node >= k)
+                return node - k;
+            std::size_t left = build(2 * node), right = build(2 * node + 1);
+            if (beats(right, left)) {
+                tree[node] = left;
+                return right;
+            }
+            tree[node] = right;
+            return left;
+        }
+
+    public:
+        /**
+         * @brief Constructor
+         * @param k - number of sources
+         * @param beats - comparison of sources
+         */
+        LoserTree(std::size_t k, Beats beats) : tree(k), k(k), beats(beats) {
+            tree[0] = build(1);
+        }
+
+        /**
+         * @brief Get the source with the next element
+         */
+        std::size_t winner() const {
+            return tree[0];
+        }
+
+        /**
+         * @brief Replay the matches of the winner after its source advanced
+         */
+        void replay() {
+            std::size_t w = tree[0];
+            for (std::size_t node = (w + k) / 2; node > 0; node /= 2)
+                if (beats(tree[node], w))
+                    std::swap(tree[node], w);
+            tree[0] = w;
+        }
+    };
+
+    /**
+     * @brief Read up to a block of records
+     * @returns number of records read
+     */
+    template <typename T>
+    std::size_t read_block(std::ifstream &file, std::vector<T> &block) {
+        file.read(reinterpret_cast<char *>(block.data()), (std::streamsize) (block.size() * sizeof(T)));
+        std::size_t bytes = (std::size_t) file.gcount();
+        if (bytes % sizeof(T) != 0)
+            throw std::runtime_error("File size is not a multiple of record size");
+        return bytes / sizeof(T);
+    }
+
+    /**
+     * @brief Open a file for binary reading
+     */
+    inline std::ifstream open_input(const std::filesystem::path &path) {
+        std::ifstream file(path, std::ios::binary);
+        if (!file)
+            throw std::runtime_error("Cannot open file " + path.string());
+        return file;
+    }
+
+    /**
+     * @brief Open a file for binary writing
+     */
+    inline std::ofstream open_output(const std::filesystem::path &path) {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        if (!file)
+            throw std::runtime_error("Cannot open file " + path.string());
+        return file;
+    }
+
+    /**
+     * @brief Sequential reader of a run with a block read ahead
+     */
+    template <typename T>
+    class RunReader {
+        std::ifstream file;
+        std::vector<T> current, next;
+        std::size_t pos = 0, size = 0;
+        std::future<std::size_t> pending;
+        ExternalSortStats &stats;
+
+        void read_ahead() {
+            pending = std::async(std::launch::async, [this] {return read_block(file, next);});
+        }
+
+    public:
+        RunReader(const std::filesystem::path &path, std::size_t block, ExternalSortStats &stats)
+                : file(open_input(path)), current(block), next(block), stats(stats) {
+            read_ahead();
+            advance();
+        }
+
+        RunReader(const RunReader &) = delete;
+        RunReader &operator=(const RunReader &) = delete;
+
+        ~RunReader() {
+            if (pending.valid())
+                pending.wait();
+        }
+
+        bool empty() const {
+            return pos == size;
+        }
+
+        const T &head() const {
+            return current[pos];
+        }
+
+        /**
+         * @brief Move to the next record, switching blocks when the current one ends
+         */
+        void advance() {
+            if (++pos < size)
+                return;
+            if (!pending.valid()) {
+                pos = size = 0;
+                return;
+            }
+            size = pending.get();
+            pos = 0;
+            stats.bytes_read += size * sizeof(T);
+            std::swap(current, next);
+            if (size == next.size())
+                read_ahead();
+        }
+    };
+
+    /**
+     * @brief Sequential writer that writes one block while the other one is filled
+     */
+    template <typename T>
+    class RunWriter {
+        std::ofstream file;
+        std::vector<T> current, writing;
+        std::size_t size = 0;
+        std::future<void> pending;
+        ExternalSortStats &stats;
+
+    public:
+        RunWriter(const std::filesystem::path &path, std::size_t block, ExternalSortStats &stats)
+                : file(open_output(path)), current(block), writing(block), stats(stats) {}
+
+        RunWriter(const RunWriter &) = delete;
+        RunWriter &operator=(const RunWriter &) = delete;
+
+        ~RunWriter() {
+            if (pending.valid())
+                pending.wait();
+        }
+
+        void push(const T &x) {
+            current[size++] = x;
+            if (size == current.size())
+                flush();
+        }
+
+        /**
+         * @brief Start writing the filled part of the current block
+         */
+        void flush() {
+            if (pending.valid())
+                pending.get();
+            std::swap(current, writing);
+            std::size_t count = size;
+            size = 0;
+            stats.bytes_written += count * sizeof(T);
+            pending = std::async(std::launch::async, [this, count] {
+                if (!file.write(reinterpret_cast<const char *>(writing.data()), (std::streamsize) (count * sizeof(T))))
+                    throw std::runtime_error("Cannot write file");
+            });
+        }
+
+        /**
+         * @brief Write everything and close the file
+         */
+        void close() {
+            flush();
+            pending.get();
+            file.close();
+        }
+    };
+
+    /**
+     * @brief Temporary run files, the ones that are left are removed when the sort ends or throws
+     */
+    class TempFiles {
+        std::filesystem::path dir;
+        std::string prefix;
+        std::size_t count = 0;
+
+    public:
+        explicit TempFiles(std::filesystem::path dir)
+                : dir(std::move(dir)), prefix("external_sort_" + std::to_string(std::random_device()()) + "_") {}
+
+        TempFiles(const TempFiles &) = delete;
+        TempFiles &operator=(const TempFiles &) = delete;
+
+        ~TempFiles() {
+            std::error_code error;
+            for (std::size_t i = 0; i < count; i++)
+                std::filesystem::remove(path(i), error);
+        }
+
+        /**
+         * @brief Get the path of the i-th file
+         */
+        std::filesystem::path path(std::size_t i) const {
+            return dir / (prefix + std::to_string(i) + ".run");
+        }
+
+        /**
+         * @brief Get the path of a new file
+         */
+        std::filesystem::path next() {
+            return path(count++);
+        }
+    };
+
+    /**
+     * @brief Merge sorted runs into one file
+     * @param runs - files of sorted runs
+     * @param output - file for the result
+     * @param block - records per I/O block
+     */
+    template <typename T, typename Compare>
+    void merge(const std::vector<std::filesystem::path> &runs, const std::filesystem::path &output,
+               std::size_t block, Compare &func, ExternalSortStats &stats) {
+        std::vector<std::unique_ptr<RunReader<T>>> readers;
+        for (auto &run : runs)
+            readers.push_back(std::make_unique<RunReader<T>>(run, block, stats));
+        // exhausted runs lose every match, ties go to the earlier run
+        auto beats = [&](std::size_t a, std::size_t b) {
+            if (readers[a]->empty())
+                return false;
+            if (readers[b]->empty())
+                return true;
+            if (func(readers[a]->head(), readers[b]->head()))
+                return true;
+            return !func(readers[b]->head(), readers[a]->head()) && a < b;
+        };
+        LoserTree tree(runs.size(), beats);
+        RunWriter<T> writer(output, block, stats);
+        while (!readers[tree.winner()]->empty()) {
+            RunReader<T> &reader = *readers[tree.winner()];
+            writer.push(reader.head());
+            reader.advance();
+            tree.replay();
+        }
+        writer.close();
+    }
+}
+
+/****************************************************************
+ * @brief External Merge Sort algorithm
+ * @param input - binary file of records of type T
+ * @param output - file for the sorted records, may be the same as input
+ * @param func - comparison function, true if the first argument goes before the second
+ * @param memory - memory limit for the buffers in bytes
+ * @param temp_dir - directory for the runs, the system temporary directory by default
+ * @returns statistics of the sort
+ ****************************************************************/
+template <typename T, typename Compare>
+requires std::strict_weak_order<Compare &, const T &, const T &>
+ExternalSortStats external_sort(const std::filesystem::path &input, const std::filesystem::path &output,
+                                Compare func, std::size_t memory = std::size_t(64) << 20,
+                                std::filesystem::path temp_dir = {}) {
+    static_assert(std::is_trivially_copyable_v<T>, "records are copied as raw bytes");
+    using namespace external_sort_detail;
+    namespace fs = std::filesystem;
+    if (temp_dir.empty())
+        temp_dir = fs::temp_directory_path();
+    TempFiles temp_files(temp_dir);
+    auto temp_file = [&] {return temp_files.next();};
+
+    ExternalSortStats stats;
+    std::vector<fs::path> runs;
+
+    // region run generation
+    {
+        std::size_t chunk = std::max<std::size_t>(memory / 2 / sizeof(T), 1);
+        std::ifstream file = open_input(input);
+        std::vector<T> current(chunk), next(chunk);
+        std::future<std::size_t> reading = std::async(std::launch::async, [&] {return read_block(file, next);});
+        std::future<void> writing;
+        while (true) {
+            std::size_t size = reading.get();
+            if (size == 0)
+                break;
+            stats.records += size;
+            stats.bytes_read += size * sizeof(T);
+            // the buffer of the previous run is free once it is written
+            if (writing.valid())
+                writing.get();
+            std::swap(current, next);
+            if (size == chunk)
+                reading = std::async(std::launch::async, [&] {return read_block(file, next);});
+            else
+                reading = std::async(std::launch::deferred, [] {return std::size_t(0);});
+            pdq_sort(current, 0, size, func);
+            runs.push_back(temp_file());
+            stats.bytes_written += size * sizeof(T);
+            writing = std::async(std::launch::async, [&, size, path = runs.back()] {
+                std::ofstream run = open_output(path);
+                if (!run.write(reinterpret_cast<const char *>(current.data()), (std::streamsize) (size * sizeof(T))))
+                    throw std::runtime_error("Cannot write file " + path.string());
+            });
+        }
+        if (writing.valid())
+            writing.get();
+    }
+    stats.runs = runs.size();
+    // endregion
+
+    // region merge
+    if (runs.empty()) {
+        open_output(output);
+        return stats;
+    }
+    // two blocks for every run being merged and two for the output
+    std::size_t fan_in = std::max<std::size_t>(memory / (2 * MIN_BLOCK_BYTES), 3) - 1;
+    while (runs.size() > 1) {
+        std::vector<fs::path> merged;
+        bool last = runs.size() <= fan_in;
+        for (std::size_t start = 0; start < runs.size(); start += fan_in) {
+            std::vector<fs::path> group(runs.begin() + start, runs.begin() + std::min(runs.size(), start + fan_in));
+            std::size_t block = std::max<std::size_t>(memory / (2 * (group.size() + 1)) / sizeof(T), 1);
+            merged.push_back(last ? output : temp_file());
+            if (group.size() == 1)
+                fs::rename(group[0], merged.back());
+            else {
+                merge<T>(group, merged.back(), block, func, stats);
+                for (auto &run : group)
+                    fs::remove(run);
+            }
+        }
+        stats.merge_passes++;
+        runs = std::move(merged);
+    }
+    // a single run is already the result
+    if (stats.merge_passes == 0) {
+        std::error_code error;
+        fs::rename(runs[0], output, error);
+        if (error) {
+            fs::copy_file(runs[0], output, fs::copy_options::overwrite_existing);
+            fs::remove(runs[0]);
+        }
+    }
+    // endregion
+    return stats;
+}
+
+/****************************************************************
+ * @brief External Merge Sort algorithm in ascending order
+ * @param input - binary file of records of type T
+ * @param output - file for the sorted records
+ * @param memory - memory limit for the buffers in bytes
+ ****************************************************************/
+template <typename T>
+ExternalSortStats external_sort(const std::filesystem::path &input, const std::filesystem::path &output,
+                                std::size_t memory = std::size_t(64) << 20) {
+    return external_sort<T>(input, output, std::less<>(), memory);
+}
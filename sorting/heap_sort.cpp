@@ -0,0 +1,52 @@
+/****************************************************************
+ * @file
+ * @brief Heap Sort tests
+****************************************************************/
+
+#include <iostream>
+#include <string>
+#include <vector>
+#include "heap_sort.h"
+
+template <typename T>
+bool comp(T a, T b){return a > b;}
+
+int main(){
+    // region test 1
+    std::vector<int> v1({5, 4, 3, 2, 1});
+    for(auto i: v1)
+        std::cout << i << " ";
+    std::cout << std::endl;
+    heap_sort(v1, comp);
+    for(auto i: v1)
+        std::cout << i << " ";
+    std::cout << std::endl;
+    // endregion
+
+    // region test 2
+    std::vector<int> v2;
+    heap_sort(v2, comp);
+    // endregion
+
+    // region test 3
+    std::vector<double> v3({1.1, -3.5, 2.3, 1123.3});
+    for(auto i: v3)
+        std::cout << i << " ";
+    std::cout << std::endl;
+    heap_sort(v3, comp);
+    for(auto i: v3)
+        std::cout << i << " ";
+    std::cout << std::endl;
+    // endregion
+
+    // region test 3
+    std::vector<std::string> v4({"abc", "a", "aaa", "zxc"});
+    for(auto i: v4)
+        std::cout << i << " ";
+    std::cout << std::endl;
+    heap_sort(v4, comp);
+    for(auto i: v4)
+        std::cout << i << " ";
+    std::cout << std::endl;
+    // endregion
+}
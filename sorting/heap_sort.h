@@ -0,0 +1,80 @@
+/****************************************************************
+ * @file
+ * @brief Heap Sort Algorithm
+ * @details
+ * Heap sort builds a binary heap inside the array and repeatedly moves
+ * its lead element to the end of the unsorted part.
+ * It is not stable, but it is in-place and O(n log n) for every input,
+ * which makes it the fallback of quicksort when pivots keep failing.
+ *
+ * ### Complexity
+ * Sort :  O(n log n)
+ * Space Complexity : O(1)
+****************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+/****************************************************************
+ * @brief Restore heap property below a node
+ * @param arr - array with the heap
+ * @param left - first index of the heap
+ * @param size - number of elements in the heap
+ * @param i - node to sift down, relative to left
+ * @param func - comparison function, the heap keeps the element going last on top
+ ****************************************************************/
+template <typename T, typename Compare>
+void sift_down(std::vector<T> &arr, std::size_t left, std::size_t size, std::size_t i, Compare func) {
+    T val = std::move(arr[left + i]);
+    while (2 * i + 1 < size) {
+        std::size_t child = 2 * i + 1;
+        if (child + 1 < size && func(arr[left + child], arr[left + child + 1]))
+            child++;
+        if (!func(val, arr[left + child]))
+            break;
+        arr[left + i] = std::move(arr[left + child]);
+        i = child;
+    }
+    arr[left + i] = std::move(val);
+}
+
+/****************************************************************
+ * @brief Heap Sort algorithm on a range
+ * @param arr - array to sort
+ * @param left - first index of the range
+ * @param right - index after the last one of the range
+ * @param func - comparison function, true if the first argument goes before the second
+ ****************************************************************/
+template <typename T, typename Compare>
+void heap_sort(std::vector<T> &arr, std::size_t left, std::size_t right, Compare func) {
+    std::size_t n = right - left;
+    for (std::size_t i = n / 2; i-- > 0;)
+        sift_down(arr, left, n, i, func);
+    for (std::size_t size = n; size > 1; size--) {
+        std::swap(arr[left], arr[left + size - 1]);
+        sift_down(arr, left, size - 1, 0, func);
+    }
+}
+
+/****************************************************************
+ * @brief Heap Sort algorithm
+ * @param arr - array to sort
+ * @param func - comparison function, true if the first argument goes before the second
+ ****************************************************************/
+template <typename T, typename Compare>
+void heap_sort(std::vector<T> &arr, Compare func) {
+    heap_sort(arr, 0, arr.size(), func);
+}
+
+/****************************************************************
+ * @brief Heap Sort algorithm
+ * @param arr - array to sort
+ * @param func - comparison function, true if the first argument goes before the second
+ ****************************************************************/
+template <typename T>
+void heap_sort(std::vector<T> &arr, bool (*func)(T, T)) {
+    heap_sort<T, bool (*)(T, T)>(arr, 0, arr.size(), func);
+}
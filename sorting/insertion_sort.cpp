@@ -1,36 +1,12 @@
 /****************************************************************
  * @file
- * @brief Insertion Sort Algorithm
- * @details
- * Insertion sort is a simple sorting algorithm that builds the final
- * sorted array (or list) one item at a time.
- *
- * ### Complexity
- * Sort :  O(n^2)
- * Space Complexity : O(1)
+ * @brief Insertion Sort tests
 ****************************************************************/
 
 #include <iostream>
+#include <string>
 #include <vector>
-
-/****************************************************************
- * @brief Insertion Sort algorithm
- * @param arr - array to sort
- * @param func - comparison function
- ****************************************************************/
-template <typename T>
-void insertion_sort(std::vector<T> &arr, bool (*func)(T, T)) {
-    int n = arr.size();
-    for (int i = 1; i < n; i++) {
-        T key = arr[i];
-        int j = i - 1;
-        while (j >= 0 && !func(arr[j], key)) {
-            arr[j + 1] = arr[j];
-            j--;
-        }
-        arr[j + 1] = key;
-    }
-}
+#include "insertion_sort.h"
 
 template <typename T>
 bool comp(T a, T b){return a > b;}
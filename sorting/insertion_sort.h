@@ -0,0 +1,62 @@
+/****************************************************************
+ * @file
+ * @brief Insertion Sort Algorithm
+ * @details
+ * Insertion sort is a simple sorting algorithm that builds the final
+ * sorted array (or list) one item at a time.
+ * It is stable and fast on small or nearly sorted arrays, so faster sorts
+ * use it to finish small ranges.
+ *
+ * ### Complexity
+ * Sort :  O(n^2)
+ * Space Complexity : O(1)
+****************************************************************/
+
+#pragma once
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+/****************************************************************
+ * @brief Insertion Sort algorithm on a range
+ * @param arr - array to sort
+ * @param left - first index of the range
+ * @param right - index after the last one of the range
+ * @param func - comparison function, true if the first argument goes before the second
+ ****************************************************************/
+template <typename T, typename Compare>
+void insertion_sort(std::vector<T> &arr, std::size_t left, std::size_t right, Compare func) {
+    for (std::size_t i = left + 1; i < right; i++) {
+        // elements equal to key stay before it, so the sort is stable
+        if (!func(arr[i], arr[i - 1]))
+            continue;
+        T key = std::move(arr[i]);
+        std::size_t j = i;
+        do {
+            arr[j] = std::move(arr[j - 1]);
+            j--;
+        } while (j > left && func(key, arr[j - 1]));
+        arr[j] = std::move(key);
+    }
+}
+
+/****************************************************************
+ * @brief Insertion Sort algorithm
+ * @param arr - array to sort
+ * @param func - comparison function, true if the first argument goes before the second
+ ****************************************************************/
+template <typename T, typename Compare>
+void insertion_sort(std::vector<T> &arr, Compare func) {
+    insertion_sort(arr, 0, arr.size(), func);
+}
+
+/****************************************************************
+ * @brief Insertion Sort algorithm
+ * @param arr - array to sort
+ * @param func - comparison function, true if the first argument goes before the second
+ ****************************************************************/
+template <typename T>
+void insertion_sort(std::vector<T> &arr, bool (*func)(T, T)) {
+    insertion_sort<T, bool (*)(T, T)>(arr, 0, arr.size(), func);
+}
@@ -0,0 +1,130 @@
+/****************************************************************
+ * @file
+ * @brief Parallel Multiway Merge Sort tests and benchmark
+ * @details
+ * Checks parallel_sort against std::sort and std::stable_sort and measures
+ * strong scaling: the same array is sorted with 1 to 64 threads
+****************************************************************/
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "parallel_sort.h"
+
+template <typename T>
+bool comp(T a, T b) {return a > b;}
+
+int main() {
+    // region test 1
+    std::vector<int> v1({5, 4, 3, 2, 1});
+    for (auto i: v1)
+        std::cout << i << " ";
+    std::cout << std::endl;
+    parallel_sort(v1, [](int a, int b) {return a < b;});
+    for (auto i: v1)
+        std::cout << i << " ";
+    std::cout << std::endl;
+    // endregion
+
+    // region test 2
+    std::vector<int> v2;
+    parallel_sort(v2, comp<int>);
+    // endregion
+
+    // region test 3
+    std::vector<std::string> v3({"abc", "a", "aaa", "zxc"});
+    for (auto i: v3)
+        std::cout << i << " ";
+    std::cout << std::endl;
+    parallel_sort(v3, std::less<>());
+    for (auto i: v3)
+        std::cout << i << " ";
+    std::cout << std::endl;
+    // endregion
+
+    // region random test
+    std::mt19937 rng(42);
+    bool ok = true;
+    for (unsigned threads : {1u, 2u, 3u, 8u}) {
+        WorkStealingPool pool(threads);
+        for (int n : {0, 1, 1000, 20000, 100000, 300001}) {
+            for (int range : {2, 1000, 1 << 30}) {
+                std::vector<int> arr(n);
+                for (auto &x : arr)
+                    x = (int) (rng() % range);
+                std::vector<int> expected = arr;
+                std::sort(expected.begin(), expected.end(), std::greater<>());
+                parallel_sort(arr, std::greater<>(), pool);
+                ok = ok && arr == expected;
+
+                // equal keys keep the order of their indices
+                std::vector<std::pair<int, int>> pairs(n);
+                for (int i = 0; i < n; i++)
+                    pairs[i] = {(int) (rng() % range), i};
+                auto by_key = [](const std::pair<int, int> &a, const std::pair<int, int> &b) {
+                    return a.first < b.first;
+                };
+                std::vector<std::pair<int, int>> expected_pairs = pairs;
+                std::stable_sort(expected_pairs.begin(), expected_pairs.end(), by_key);
+                parallel_sort(pairs, by_key, pool, true);
+                ok = ok && pairs == expected_pairs;
+            }
+        }
+    }
+    // strings own memory, merges move them while other parts are still being split
+    for (unsigned threads : {2u, 8u, 16u}) {
+        WorkStealingPool pool(threads);
+        for (bool stable : {false, true}) {
+            std::vector<std::string> strings(1 << 18);
+            for (auto &str : strings) {
+                str.resize(rng() % 40);
+                for (auto &c : str)
+                    c = (char) ('a' + rng() % 4);
+            }
+            std::vector<std::string> expected = strings;
+            std::sort(expected.begin(), expected.end());
+            parallel_sort(strings, std::less<>(), pool, stable);
+            ok = ok && strings == expected;
+        }
+    }
+    std::cout << "Random test" << std::endl;
+    if (ok)
+        std::cout << "Random test passed" << std::endl;
+    else
+        std::cout << "Random test failed" << std::endl;
+    std::cout << std::endl;
+    // endregion
+
+    // region benchmark
+    int n = 1 << 23;
+    std::vector<int> input(n);
+    for (auto &x : input)
+        x = (int) rng();
+    std::cout << "Strong scaling on " << n << " ints, " << std::thread::hardware_concurrency()
+              << " hardware threads" << std::endl;
+    double base = 0;
+    for (unsigned threads = 1; threads <= 64; threads *= 2) {
+        WorkStealingPool pool(threads);
+        for (bool stable : {false, true}) {
+            std::vector<int> arr = input;
+            auto start = std::chrono::steady_clock::now();
+            parallel_sort(arr, std::less<>(), pool, stable);
+            auto end = std::chrono::steady_clock::now();
+            double ms = std::chrono::duration<double, std::milli>(end - start).count();
+            if (threads == 1 && !stable)
+                base = ms;
+            std::cout << threads << " threads" << (stable ? ", stable: " : ": ") << ms << " ms";
+            if (!stable)
+                std::cout << ", speedup " << base / ms;
+            std::cout << std::endl;
+        }
+    }
+    // endregion
+    return 0;
+}
@@ -0,0 +1,326 @@
+/****************************************************************
+ * @file
+ * @brief Parallel Multiway Merge Sort Algorithm
+ * @details
+ * Parallel sort for multicore machines:
+ * 1) The array is split into one chunk per thread and the chunks are sorted
+ * concurrently with pdq_sort (or tim_sort if stability is asked).
+ * 2) The output is split into one part per thread. For every border the
+ * positions in all chunks are found by co-ranking: the element at a given
+ * global rank is searched with binary searches in every chunk, so no thread
+ * has to wait for another one.
+ * 3) Every part is produced by an independent k-way merge of its slices.
+ * Ties are resolved by chunk index, so the merge keeps stability.
+ *
+ * Tasks run on WorkStealingPool: every thread owns a deque, takes its own
+ * tasks from the back and steals tasks of other threads from the front.
+ * A thread that waits for tasks runs queued tasks instead of sleeping.
+ *
+ * ### Complexity
+ * Sort :  O(n log n / p + p^2 log^2 n) with p threads
+ * Space Complexity : O(n)
+****************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "pdq_sort.h"
+#include "tim_sort.h"
+
+class WorkStealingPool {
+    struct Queue {
+        std::mutex mutex;
+        std::deque<std::function<void()>> tasks;
+    };
+
+    std::vector<std::unique_ptr<Queue>> queues;  // queues[0] belongs to threads outside the pool
+    std::vector<std::thread> workers;
+    std::atomic<std::size_t> queued{0};  // tasks waiting in all queues
+    std::atomic<bool> stop{false};
+    std::mutex sleep_mutex;
+    std::condition_variable sleep;
+
+    static inline thread_local const WorkStealingPool *current_pool = nullptr;
+    static inline thread_local std::size_t current_index = 0;
+
+    /**
+     * @brief Index of the queue of the calling thread
+     */
+    std::size_t own_index() const {
+        return current_pool == this ? current_index : 0;
+    }
+
+    /**
+     * @brief Loop of a worker thread
+     * @param index - index of the worker queue
+     */
+    void work(std::size_t index) {
+        current_pool = this;
+        current_index = index;
+        while (!stop) {
+            if (try_run_one())
+                continue;
+            std::unique_lock lock(sleep_mutex);
+            sleep.wait(lock, [this]{return stop || queued > 0;});
+        }
+    }
+
+public:
+    /**
+     * @brief Constructor
+     * @param threads - number of threads running tasks, including the one that waits for them
+     */
+    explicit WorkStealingPool(unsigned threads) {
+        threads = std::max(threads, 1u);
+        for (unsigned i = 0; i < threads; i++)
+            queues.push_back(std::make_unique<Queue>());
+        for (unsigned i = 1; i < threads; i++)
+            workers.emplace_back([this, i]{work(i);});
+    }
+
+    WorkStealingPool(const WorkStealingPool &) = delete;
+    WorkStealingPool &operator=(const WorkStealingPool &) = delete;
+
+    /**
+     * @brief Add a task to the queue of the calling thread
+     * @param task - function to run
+     */
+    void submit(std::function<void()> task) {
+        Queue &queue = *queues[own_index()];
+        {
+            std::lock_guard lock(queue.mutex);
+            queue.tasks.push_back(std::move(task));
+        }
+        queued++;
+        {
+            std::lock_guard lock(sleep_mutex);
+        }
+        sleep.notify_one();
+    }
+
+    /**
+     * @brief Run one task, own newest task first, then the oldest task of another thread
+     * @returns true if a task was run
+     */
+    bool try_run_one() {
+        std::size_t own = own_index();
+        for (std::size_t k = 0; k < queues.size(); k++) {
+            Queue &queue = *queues[(own + k) % queues.size()];
+            std::function<void()> task;
+            {
+                std::lock_guard lock(queue.mutex);
+                if (queue.tasks.empty())
+                    continue;
+                if (k == 0) {
+                    task = std::move(queue.tasks.back());
+                    queue.tasks.pop_back();
+                }
+                else {
+                    task = std::move(queue.tasks.front());
+                    queue.tasks.pop_front();
+                }
+            }
+            queued--;
+            task();
+            return true;
+        }
+        return false;
+    }
+
+    /**
+     * @brief Run tasks until a counter of unfinished tasks drops to zero
+     * @param unfinished - counter decremented by the tasks
+     */
+    void wait(const std::atomic<std::size_t> &unfinished) {
+        while (unfinished > 0)
+            if (!try_run_one())
+                std::this_thread::yield();
+    }
+
+    /**
+     * @brief Get number of threads
+     * @returns number of threads including the waiting one
+     */
+    std::size_t size() const {
+        return queues.size();
+    }
+
+    /**
+     * @brief Destructor
+     */
+    ~WorkStealingPool() {
+        {
+            std::lock_guard lock(sleep_mutex);
+            stop = true;
+        }
+        sleep.notify_all();
+        for (auto &worker : workers)
+            worker.join();
+    }
+};
+
+namespace parallel_sort_detail {
+    constexpr std::size_t SEQUENTIAL_THRESHOLD = 1 << 14;  // smaller arrays are sorted by one thread
+
+    /**
+     * @brief Find where the elements of global rank below r end in every sorted chunk
+     * @param arr - array of sorted chunks
+     * @param borders - borders[i] is the first index of chunk i, the last one is the size of the array
+     * @param r - global rank
+     * @returns split position in every chunk, they sum up to r
+     */
+    template <typename T, typename Compare>
+    std::vector<std::size_t> co_rank(const std::vector<T> &arr, const std::vector<std::size_t> &borders,
+                                     std::size_t r, Compare &func) {
+        // elements are ordered by value, then by chunk, then by position
+        std::size_t k = borders.size() - 1;
+        std::vector<std::size_t> lo(borders.begin(), borders.end() - 1), hi(borders.begin() + 1, borders.end());
+        while (true) {
+            // pivot is the middle of the longest unresolved range
+            std::size_t j = 0;
+            for (std::size_t i = 1; i < k; i++)
+                if (hi[i] - lo[i] > hi[j] - lo[j])
+                    j = i;
+            if (hi[j] == lo[j])
+                break;
+            std::size_t m = lo[j] + (hi[j] - lo[j]) / 2;
+            const T &pivot = arr[m];
+            // position of the pivot in every chunk
+            std::vector<std::size_t> pos(k);
+            std::size_t rank = 0;
+            for (std::size_t i = 0; i < k; i++) {
+                if (i < j)
+                    pos[i] = std::upper_bound(arr.begin() + lo[i], arr.begin() + hi[i], pivot, func) - arr.begin();
+                else if (i > j)
+                    pos[i] = std::lower_bound(arr.begin() + lo[i], arr.begin() + hi[i], pivot, func) - arr.begin();
+                else
+                    pos[i] = m;
+                rank += pos[i] - borders[i];
+            }
+            // elements before the pivot positions all have rank below r, or none of the others do
+            if (rank < r) {
+                for (std::size_t i = 0; i < k; i++)
+                    lo[i] = pos[i];
+                lo[j] = m + 1;
+            }
+            else
+                for (std::size_t i = 0; i < k; i++)
+                    hi[i] = pos[i];
+        }
+        return lo;
+    }
+
+    /**
+     * @brief Merge slices of sorted chunks, ties go to the chunk with smaller index
+     * @param arr - array of sorted chunks
+     * @param from - first index of every slice
+     * @param to - index after the last one of every slice
+     * @param out - output array
+     * @param out_pos - first index in the output array
+     */
+    template <typename T, typename Compare>
+    void multiway_merge(std::vector<T> &arr, std::vector<std::size_t> from, const std::vector<std::size_t> &to,
+                        std::vector<T> &out, std::size_t out_pos, Compare &func) {
+        // heap of chunk indices, the top is the chunk with the next element
+        auto later = [&](std::size_t a, std::size_t b) {
+            if (func(arr[from[b]], arr[from[a]]))
+                return true;
+            return !func(arr[from[a]], arr[from[b]]) && a > b;
+        };
+        std::vector<std::size_t> heap;
+        for (std::size_t i = 0; i < from.size(); i++)
+            if (from[i] < to[i])
+                heap.push_back(i);
+        std::make_heap(heap.begin(), heap.end(), later);
+        while (!heap.empty()) {
+            std::pop_heap(heap.begin(), heap.end(), later);
+            std::size_t i = heap.back();
+            out[out_pos++] = std::move(arr[from[i]++]);
+            if (from[i] < to[i])
+                std::push_heap(heap.begin(), heap.end(), later);
+            else
+                heap.pop_back();
+        }
+    }
+}
+
+/****************************************************************
+ * @brief Parallel Multiway Merge Sort algorithm
+ * @param arr - array to sort
+ * @param func - comparison function, true if the first argument goes before the second
+ * @param pool - threads to sort with
+ * @param stable - keep the order of equal elements
+ ****************************************************************/
+template <typename T, typename Compare>
+void parallel_sort(std::vector<T> &arr, Compare func, WorkStealingPool &pool, bool stable = false) {
+    using namespace parallel_sort_detail;
+    std::size_t n = arr.size();
+    std::size_t p = std::min(pool.size(), std::max<std::size_t>(n / SEQUENTIAL_THRESHOLD, 1));
+    auto sort_range = [&](std::size_t left, std::size_t right) {
+        if (stable)
+            tim_sort(arr, left, right, func);
+        else
+            pdq_sort(arr, left, right, func);
+    };
+    if (p == 1) {
+        sort_range(0, n);
+        return;
+    }
+
+    std::vector<std::size_t> borders(p + 1);
+    for (std::size_t i = 0; i <= p; i++)
+        borders[i] = n * i / p;
+    std::atomic<std::size_t> unfinished{p};
+    for (std::size_t i = 0; i < p; i++)
+        pool.submit([&, i] {
+            sort_range(borders[i], borders[i + 1]);
+            unfinished--;
+        });
+    pool.wait(unfinished);
+
+    // all splits are found before any merge moves elements out of arr
+    std::vector<std::vector<std::size_t>> splits(p + 1);
+    splits[0].assign(borders.begin(), borders.end() - 1);
+    splits[p].assign(borders.begin() + 1, borders.end());
+    unfinished = p - 1;
+    for (std::size_t part = 1; part < p; part++)
+        pool.submit([&, part] {
+            splits[part] = co_rank(arr, borders, n * part / p, func);
+            unfinished--;
+        });
+    pool.wait(unfinished);
+
+    std::vector<T> buffer(n);
+    unfinished = p;
+    for (std::size_t part = 0; part < p; part++)
+        pool.submit([&, part] {
+            multiway_merge(arr, splits[part], splits[part + 1], buffer, n * part / p, func);
+            unfinished--;
+        });
+    pool.wait(unfinished);
+    arr.swap(buffer);
+}
+
+/****************************************************************
+ * @brief Parallel Multiway Merge Sort algorithm on a new pool
+ * @param arr - array to sort
+ * @param func - comparison function, true if the first argument goes before the second
+ * @param threads - number of threads, all hardware threads by default
+ * @param stable - keep the order of equal elements
+ ****************************************************************/
+template <typename T, typename Compare>
+void parallel_sort(std::vector<T> &arr, Compare func, unsigned threads = std::thread::hardware_concurrency(),
+                   bool stable = false) {
+    WorkStealingPool pool(threads);
+    parallel_sort(arr, func, pool, stable);
+}
@@ -0,0 +1,148 @@
+/****************************************************************
+ * @file
+ * @brief Partial Sort, Nth Element and Top-K tests and benchmark
+ * @details
+ * Checks the selection algorithms against the standard library and compares
+ * their speed with sorting the whole array when only the top 100 is needed
+****************************************************************/
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+#include "partial_sort.h"
+
+template <typename T>
+bool comp(T a, T b) {return a > b;}
+
+/****************************************************************
+ * @brief Measure running time
+ * @param arr - input array, copied
+ * @param run - function to measure
+ * @return milliseconds
+ ****************************************************************/
+template <typename F>
+double measure(std::vector<int> arr, F run) {
+    auto start = std::chrono::steady_clock::now();
+    run(arr);
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+int main() {
+    // region test 1
+    std::vector<int> v1({5, 9, 3, 7, 1, 8, 2});
+    for (auto i: v1)
+        std::cout << i << " ";
+    std::cout << std::endl;
+    partial_sort(v1, 3, std::less<>());
+    for (auto i: v1)
+        std::cout << i << " ";
+    std::cout << std::endl;
+    // endregion
+
+    // region test 2
+    std::vector<int> v2;
+    partial_sort(v2, 3, comp<int>);
+    nth_element(v2, 0, comp<int>);
+    // endregion
+
+    // region test 3
+    std::vector<std::string> v3({"abc", "a", "aaa", "zxc", "b"});
+    nth_element(v3, 2, std::less<>());
+    std::cout << "third string: " << v3[2] << std::endl;
+    // endregion
+
+    // region test 4
+    std::istringstream stream("17 4 42 8 15 23 16");
+    for (auto i: top_k(std::istream_iterator<int>(stream), std::istream_iterator<int>(), 3, std::greater<>()))
+        std::cout << i << " ";
+    std::cout << std::endl;
+    // endregion
+
+    // region random test
+    std::mt19937 rng(42);
+    bool ok = true;
+    for (int n = 0; n <= 20000 && ok; n += 1 + n / 2) {
+        for (int range : {1, 2, 100, 1 << 30}) {
+            std::vector<int> arr(n);
+            for (auto &x : arr)
+                x = (int) (rng() % range);
+            std::vector<int> sorted = arr;
+            std::sort(sorted.begin(), sorted.end());
+            for (std::size_t k : {std::size_t(0), std::size_t(1), std::size_t(n / 100), std::size_t(n / 2),
+                                  std::size_t(n)}) {
+                std::vector<int> a = arr;
+                partial_sort(a, k, std::less<>());
+                ok = ok && std::equal(a.begin(), a.begin() + std::min<std::size_t>(k, n), sorted.begin());
+                std::sort(a.begin(), a.end());
+                ok = ok && a == sorted;
+
+                std::vector<int> top = top_k(arr.begin(), arr.end(), k, std::less<>());
+                ok = ok && std::equal(top.begin(), top.end(), sorted.begin())
+                     && top.size() == std::min<std::size_t>(k, n);
+
+                if (k < (std::size_t) n) {
+                    a = arr;
+                    nth_element(a, k, std::less<>());
+                    ok = ok && a[k] == sorted[k];
+                    ok = ok && std::all_of(a.begin(), a.begin() + k, [&](int x) {return x <= a[k];});
+                    ok = ok && std::all_of(a.begin() + k, a.end(), [&](int x) {return x >= a[k];});
+                }
+            }
+        }
+    }
+    // patterns that break quickselect with median-of-3 pivots
+    for (int n : {1000, 30000}) {
+        std::vector<int> organ(n);
+        for (int i = 0; i < n; i++)
+            organ[i] = i < n / 2 ? i : n - i;
+        std::vector<int> sorted = organ;
+        std::sort(sorted.begin(), sorted.end());
+        nth_element(organ, n / 3, std::less<>());
+        ok = ok && organ[n / 3] == sorted[n / 3];
+    }
+    std::cout << "Random test" << std::endl;
+    if (ok)
+        std::cout << "Random test passed" << std::endl;
+    else
+        std::cout << "Random test failed" << std::endl;
+    std::cout << std::endl;
+    // endregion
+
+    // region benchmark
+    int n = 1 << 24;
+    std::size_t k = 100;
+    std::vector<int> input(n);
+    for (auto &x : input)
+        x = (int) rng();
+    std::cout << "Benchmark on " << n << " ints, top " << k << std::endl;
+    std::cout << "partial_sort: " << measure(input, [k](std::vector<int> &a) {
+        partial_sort(a, k, std::greater<>());
+    }) << " ms" << std::endl;
+    std::cout << "top_k: " << measure(input, [k](std::vector<int> &a) {
+        top_k(a.begin(), a.end(), k, std::greater<>());
+    }) << " ms" << std::endl;
+    std::cout << "nth_element + pdq_sort: " << measure(input, [k](std::vector<int> &a) {
+        nth_element(a, k, std::greater<>());
+        pdq_sort(a, 0, k, std::greater<>());
+    }) << " ms" << std::endl;
+    std::cout << "std::partial_sort: " << measure(input, [k](std::vector<int> &a) {
+        std::partial_sort(a.begin(), a.begin() + (std::ptrdiff_t) k, a.end(), std::greater<>());
+    }) << " ms" << std::endl;
+    std::cout << "pdq_sort of everything: " << measure(input, [](std::vector<int> &a) {
+        pdq_sort(a, std::greater<>());
+    }) << " ms" << std::endl;
+    std::cout << "nth_element of the median: " << measure(input, [n](std::vector<int> &a) {
+        nth_element(a, n / 2, std::less<>());
+    }) << " ms, std::nth_element: " << measure(input, [n](std::vector<int> &a) {
+        std::nth_element(a.begin(), a.begin() + n / 2, a.end());
+    }) << " ms" << std::endl;
+    // endregion
+    return 0;
+}
@@ -0,0 +1,199 @@
+/****************************************************************
+ * @file
+ * @brief Partial Sort, Nth Element and Top-K Selection Algorithms
+ * @details
+ * Selection algorithms for when only a few elements of the sorted order are
+ * needed:
+ * 1) nth_element puts the element that would be k-th in the sorted array to
+ * position k, elements before it do not go after it and the rest do not go
+ * before it. It is introselect: quickselect with the pivots and partitions
+ * of pdq_sort. After log n bad partitions pivots are chosen by median of
+ * medians, so the worst case stays linear.
+ * 2) partial_sort sorts the first k elements. For small k the first k
+ * elements are kept in a heap of the k best seen so far, other elements
+ * only replace its top, otherwise it is nth_element followed by pdq_sort.
+ * 3) top_k reads a stream once with the same bounded heap and returns the
+ * k first elements in sorted order.
+ *
+ * ### Complexity
+ * Nth element :  O(n)
+ * Partial sort :  O(n log k)
+ * Top k :  O(n log k)
+ * Space Complexity : O(log n) for nth_element and partial_sort, O(k) for top_k
+****************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <iterator>
+#include <utility>
+#include <vector>
+#include "heap_sort.h"
+#include "insertion_sort.h"
+#include "pdq_sort.h"
+
+namespace partial_sort_detail {
+    constexpr std::size_t INSERTION_SELECT_THRESHOLD = 24;  // ranges shorter than this are insertion sorted
+    constexpr std::size_t HEAP_SELECT_RATIO = 16;  // partial_sort uses the heap while k <= n / HEAP_SELECT_RATIO
+
+    template <typename T, typename Compare>
+    void nth_element_loop(std::vector<T> &arr, std::size_t left, std::size_t right, std::size_t k,
+                          Compare &func, bool leftmost);
+
+    /**
+     * @brief Move the median of medians of groups of 5 to arr[left]
+     */
+    template <typename T, typename Compare>
+    void median_of_medians(std::vector<T> &arr, std::size_t left, std::size_t right, Compare &func) {
+        std::size_t groups = (right - left) / 5;
+        for (std::size_t g = 0; g < groups; g++) {
+            std::size_t first = left + 5 * g;
+            insertion_sort(arr, first, first + 5, func);
+            std::swap(arr[left + g], arr[first + 2]);
+        }
+        nth_element_loop(arr, left, left + groups, left + groups / 2, func, true);
+        std::swap(arr[left], arr[left + groups / 2]);
+    }
+
+    /**
+     * @brief Introselect on a range
+     * @param k - position to put the right element to
+     * @param leftmost - true if nothing is to the left of the range
+     */
+    template <typename T, typename Compare>
+    void nth_element_loop(std::vector<T> &arr, std::size_t left, std::size_t right, std::size_t k,
+                          Compare &func, bool leftmost) {
+        int bad_allowed = std::bit_width(right - left);
+        while (right - left >= INSERTION_SELECT_THRESHOLD) {
+            std::size_t size = right - left;
+            if (bad_allowed > 0)
+                pdq_sort_detail::choose_pivot(arr, left, right, func);
+            else
+                median_of_medians(arr, left, right, func);
+
+            // the element before the range is a previous pivot, not greater than anything in the range
+            if (!leftmost && !func(arr[left - 1], arr[left])) {
+                std::size_t pivot_pos = pdq_sort_detail::partition_left(arr, left, right, func);
+                if (k <= pivot_pos)
+                    return;
+                left = pivot_pos + 1;
+                continue;
+            }
+
+            std::size_t pivot_pos = pdq_sort_detail::partition_right(arr, left, right, func).first;
+            if (pivot_pos - left < size / 8 || right - pivot_pos - 1 < size / 8)
+                bad_allowed--;
+            if (k == pivot_pos)
+                return;
+            if (k < pivot_pos)
+                right = pivot_pos;
+            else {
+                left = pivot_pos + 1;
+                leftmost = false;
+            }
+        }
+        insertion_sort(arr, left, right, func);
+    }
+
+    /**
+     * @brief Keep the k elements going first of arr[left, right) in a heap at arr[left, left + k)
+     * @details the heap keeps the element going last on top
+     */
+    template <typename T, typename Compare>
+    void heap_select(std::vector<T> &arr, std::size_t left, std::size_t right, std::size_t k, Compare &func) {
+        for (std::size_t i = k / 2; i-- > 0;)
+            sift_down(arr, left, k, i, func);
+        for (std::size_t i = left + k; i < right; i++)
+            if (func(arr[i], arr[left])) {
+                std::swap(arr[i], arr[left]);
+                sift_down(arr, left, k, 0, func);
+            }
+    }
+}
+
+/****************************************************************
+ * @brief Nth Element algorithm on a range
+ * @param arr - array to reorder
+ * @param left - first index of the range
+ * @param right - index after the last one of the range
+ * @param k - position that receives its element of the sorted order
+ * @param func - comparison function, true if the first argument goes before the second
+ ****************************************************************/
+template <typename T, typename Compare>
+void nth_element(std::vector<T> &arr, std::size_t left, std::size_t right, std::size_t k, Compare func) {
+    if (k < left || k >= right)
+        return;
+    partial_sort_detail::nth_element_loop(arr, left, right, k, func, true);
+}
+
+/****************************************************************
+ * @brief Nth Element algorithm
+ * @param arr - array to reorder
+ * @param k - position that receives its element of the sorted order
+ * @param func - comparison function, true if the first argument goes before the second
+ ****************************************************************/
+template <typename T, typename Compare>
+void nth_element(std::vector<T> &arr, std::size_t k, Compare func) {
+    nth_element(arr, 0, arr.size(), k, func);
+}
+
+/****************************************************************
+ * @brief Partial Sort algorithm
+ * @param arr - array to reorder
+ * @param k - number of first elements to sort, the rest is in no particular order
+ * @param func - comparison function, true if the first argument goes before the second
+ ****************************************************************/
+template <typename T, typename Compare>
+void partial_sort(std::vector<T> &arr, std::size_t k, Compare func) {
+    using namespace partial_sort_detail;
+    std::size_t n = arr.size();
+    k = std::min(k, n);
+    if (k == 0)
+        return;
+    if (k <= n / HEAP_SELECT_RATIO) {
+        heap_select(arr, 0, n, k, func);
+        // the heap is built, only the extraction of heap sort is left
+        for (std::size_t size = k; size > 1; size--) {
+            std::swap(arr[0], arr[size - 1]);
+            sift_down(arr, 0, size - 1, 0, func);
+        }
+        return;
+    }
+    if (k < n)
+        nth_element_loop(arr, 0, n, k - 1, func, true);
+    pdq_sort(arr, 0, k, func);
+}
+
+/****************************************************************
+ * @brief Top-K algorithm on a stream
+ * @param first - iterator to the first element
+ * @param last - iterator after the last element
+ * @param k - number of elements to keep
+ * @param func - comparison function, true if the first argument goes before the second
+ * @returns the k elements going first, sorted
+ ****************************************************************/
+template <typename InputIt, typename Compare>
+std::vector<typename std::iterator_traits<InputIt>::value_type> top_k(InputIt first, InputIt last, std::size_t k,
+                                                                      Compare func) {
+    using T = typename std::iterator_traits<InputIt>::value_type;
+    std::vector<T> heap;
+    if (k == 0)
+        return heap;
+    heap.reserve(k);
+    for (; first != last && heap.size() < k; ++first)
+        heap.push_back(*first);
+    for (std::size_t i = heap.size() / 2; i-- > 0;)
+        sift_down(heap, 0, heap.size(), i, func);
+    for (; first != last; ++first)
+        if (func(*first, heap[0])) {
+            heap[0] = *first;
+            sift_down(heap, 0, k, 0, func);
+        }
+    for (std::size_t size = heap.size(); size > 1; size--) {
+        std::swap(heap[0], heap[size - 1]);
+        sift_down(heap, 0, size - 1, 0, func);
+    }
+    return heap;
+}
@@ -0,0 +1,127 @@
+/****************************************************************
+ * @file
+ * @brief Pattern-defeating Quicksort tests and benchmark
+ * @details
+ * Checks pdq_sort against std::sort and compares their speed on random,
+ * sorted, reversed and many-duplicates inputs
+****************************************************************/
+
+#include <algorithm>
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "pdq_sort.h"
+
+template <typename T>
+bool comp(T a, T b){return a > b;}
+
+/****************************************************************
+ * @brief Measure sorting time
+ * @param arr - array to sort, copied
+ * @param sort - sorting function
+ * @return milliseconds
+ ****************************************************************/
+template <typename F>
+double measure(std::vector<int> arr, F sort){
+    auto start = std::chrono::steady_clock::now();
+    sort(arr);
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+int main(){
+    // region test 1
+    std::vector<int> v1({5, 4, 3, 2, 1});
+    for(auto i: v1)
+        std::cout << i << " ";
+    std::cout << std::endl;
+    pdq_sort(v1, [](int a, int b){return a < b;});
+    for(auto i: v1)
+        std::cout << i << " ";
+    std::cout << std::endl;
+    // endregion
+
+    // region test 2
+    std::vector<int> v2;
+    pdq_sort(v2, comp);
+    // endregion
+
+    // region test 3
+    std::vector<double> v3({1.1, -3.5, 2.3, 1123.3});
+    for(auto i: v3)
+        std::cout << i << " ";
+    std::cout << std::endl;
+    pdq_sort(v3, comp);
+    for(auto i: v3)
+        std::cout << i << " ";
+    std::cout << std::endl;
+    // endregion
+
+    // region test 4
+    std::vector<std::string> v4({"abc", "a", "aaa", "zxc"});
+    for(auto i: v4)
+        std::cout << i << " ";
+    std::cout << std::endl;
+    pdq_sort(v4, std::less<>());
+    for(auto i: v4)
+        std::cout << i << " ";
+    std::cout << std::endl;
+    // endregion
+
+    // region random test
+    std::mt19937 rng(42);
+    bool ok = true;
+    for(int n = 0; n <= 5000 && ok; n += 1 + n / 3){
+        for(int range : {2, 100, 1 << 30}){
+            std::vector<int> arr(n);
+            for(auto &x : arr)
+                x = (int) (rng() % range);
+            if(n % 3 == 1)
+                std::sort(arr.begin(), arr.begin() + n / 2);
+            std::vector<int> expected = arr;
+            std::sort(expected.begin(), expected.end(), std::greater<>());
+            pdq_sort(arr, std::greater<>());
+            ok = ok && arr == expected;
+
+            std::vector<std::string> strings(n);
+            for(int i = 0; i < n; i++)
+                strings[i] = std::to_string(arr[i] % 1000);
+            std::vector<std::string> expected_strings = strings;
+            std::sort(expected_strings.begin(), expected_strings.end());
+            pdq_sort(strings, std::less<>());
+            ok = ok && strings == expected_strings;
+        }
+    }
+    std::cout << "Random test" << std::endl;
+    if(ok)
+        std::cout << "Random test passed" << std::endl;
+    else
+        std::cout << "Random test failed" << std::endl;
+    std::cout << std::endl;
+    // endregion
+
+    // region benchmark
+    int n = 1 << 22;
+    std::vector<std::pair<std::string, std::vector<int>>> inputs(4, {"", std::vector<int>(n)});
+    inputs[0].first = "random";
+    inputs[1].first = "sorted";
+    inputs[2].first = "reversed";
+    inputs[3].first = "many duplicates";
+    for(int i = 0; i < n; i++){
+        inputs[0].second[i] = (int) rng();
+        inputs[1].second[i] = i;
+        inputs[2].second[i] = n - i;
+        inputs[3].second[i] = (int) (rng() % 16);
+    }
+    std::cout << "Benchmark on " << n << " ints" << std::endl;
+    for(auto &[name, arr] : inputs){
+        double pdq = measure(arr, [](std::vector<int> &a){pdq_sort(a, std::less<>());});
+        double std_sort = measure(arr, [](std::vector<int> &a){std::sort(a.begin(), a.end());});
+        std::cout << name << ": pdq_sort " << pdq << " ms, std::sort " << std_sort << " ms" << std::endl;
+    }
+    // endregion
+    return 0;
+}
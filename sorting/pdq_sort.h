@@ -0,0 +1,331 @@
+/****************************************************************
+ * @file
+ * @brief Pattern-defeating Quicksort Algorithm
+ * @details
+ * Pattern-defeating quicksort (pdqsort, Orson Peters) is an introsort that
+ * adapts to the input:
+ * 1) Ranges shorter than 24 elements are finished with insertion_sort,
+ * or ranges shorter than 48 with an AVX2 sorting network if it applies.
+ * 2) The pivot is the median of 3, or the pseudomedian of 9 on large ranges.
+ * 3) Arithmetic keys are partitioned in blocks of 64 (BlockQuicksort): offsets
+ * of misplaced elements are collected without branches and swapped in bulk,
+ * so random data does not cause branch mispredictions.
+ * 4) If a partition did no swaps, the range is probably sorted and a partial
+ * insertion sort that gives up after 8 moves tries to finish it in O(n).
+ * 5) If the pivot equals the element before the range, all elements equal
+ * to it are put to the left and skipped, so many duplicates take O(n).
+ * 6) Bad partitions shuffle a few elements to break patterns, and after
+ * log n bad partitions the range is sorted with heap_sort, so the worst
+ * case is O(n log n).
+ *
+ * ### Complexity
+ * Sort :  O(n log n), O(n) on sorted, reversed and equal inputs
+ * Space Complexity : O(log n)
+****************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "heap_sort.h"
+#include "insertion_sort.h"
+#include "sorting_network.h"
+
+namespace pdq_sort_detail {
+    constexpr std::size_t INSERTION_SORT_THRESHOLD = 24;  // ranges shorter than this are insertion sorted
+    constexpr std::size_t NETWORK_THRESHOLD = 48;  // same for ranges sorted by sorting_network_sort
+    constexpr std::size_t NINTHER_THRESHOLD = 128;  // ranges longer than this use pseudomedian of 9
+    constexpr std::size_t PARTIAL_INSERTION_SORT_LIMIT = 8;  // moves allowed in partial insertion sort
+    constexpr std::size_t BLOCK_SIZE = 64;  // elements per block of block partitioning
+
+    /**
+     * @brief Sort 3 elements
+     */
+    template <typename T, typename Compare>
+    void sort3(std::vector<T> &arr, std::size_t a, std::size_t b, std::size_t c, Compare &func) {
+        if (func(arr[b], arr[a]))
+            std::swap(arr[a], arr[b]);
+        if (func(arr[c], arr[b]))
+            std::swap(arr[b], arr[c]);
+        if (func(arr[b], arr[a]))
+            std::swap(arr[a], arr[b]);
+    }
+
+    /**
+     * @brief Move the median of 3, or the pseudomedian of 9 on large ranges, to arr[left]
+     * @details the last element of the range is left not less than the pivot
+     */
+    template <typename T, typename Compare>
+    void choose_pivot(std::vector<T> &arr, std::size_t left, std::size_t right, Compare &func) {
+        std::size_t s2 = (right - left) / 2;
+        if (right - left > NINTHER_THRESHOLD) {
+            sort3(arr, left, left + s2, right - 1, func);
+            sort3(arr, left + 1, left + s2 - 1, right - 2, func);
+            sort3(arr, left + 2, left + s2 + 1, right - 3, func);
+            sort3(arr, left + s2 - 1, left + s2, left + s2 + 1, func);
+            std::swap(arr[left], arr[left + s2]);
+        }
+        else
+            sort3(arr, left + s2, left, right - 1, func);
+    }
+
+    /**
+     * @brief Insertion sort that gives up after a few moves
+     * @returns true if the range is sorted
+     */
+    template <typename T, typename Compare>
+    bool partial_insertion_sort(std::vector<T> &arr, std::size_t left, std::size_t right, Compare &func) {
+        std::size_t moves = 0;
+        for (std::size_t i = left + 1; i < right; i++) {
+            if (!func(arr[i], arr[i - 1]))
+                continue;
+            T key = std::move(arr[i]);
+            std::size_t j = i;
+            do {
+                arr[j] = std::move(arr[j - 1]);
+                j--;
+            } while (j > left && func(key, arr[j - 1]));
+            arr[j] = std::move(key);
+            moves += i - j;
+            if (moves > PARTIAL_INSERTION_SORT_LIMIT)
+                return false;
+        }
+        return true;
+    }
+
+    /**
+     * @brief Put elements equal to the pivot arr[left] to the left part
+     * @returns position of the pivot, everything before it is equal to it
+     */
+    template <typename T, typename Compare>
+    std::size_t partition_left(std::vector<T> &arr, std::size_t left, std::size_t right, Compare &func) {
+        T pivot = std::move(arr[left]);
+        std::size_t first = left, last = right;
+        while (func(pivot, arr[--last]));
+        if (last + 1 == right)
+            while (first < last && !func(pivot, arr[++first]));
+        else
+            while (!func(pivot, arr[++first]));
+        while (first < last) {
+            std::swap(arr[first], arr[last]);
+            while (func(pivot, arr[--last]));
+            while (!func(pivot, arr[++first]));
+        }
+        arr[left] = std::move(arr[last]);
+        arr[last] = std::move(pivot);
+        return last;
+    }
+
+    /**
+     * @brief Swap misplaced elements found by block partitioning
+     * @param first - base of left offsets
+     * @param last - base of right offsets
+     * @param num - number of pairs
+     * @param use_swaps - swap pairs instead of moving them in one cycle
+     */
+    template <typename T>
+    void swap_offsets(std::vector<T> &arr, std::size_t first, std::size_t last,
+                      const unsigned char *offsets_l, const unsigned char *offsets_r, std::size_t num, bool use_swaps) {
+        if (use_swaps) {
+            // the cycle below breaks when both sides have the same number of elements
+            for (std::size_t i = 0; i < num; i++)
+                std::swap(arr[first + offsets_l[i]], arr[last - offsets_r[i]]);
+        }
+        else if (num > 0) {
+            std::size_t l = first + offsets_l[0], r = last - offsets_r[0];
+            T tmp = std::move(arr[l]);
+            arr[l] = std::move(arr[r]);
+            for (std::size_t i = 1; i < num; i++) {
+                l = first + offsets_l[i];
+                arr[r] = std::move(arr[l]);
+                r = last - offsets_r[i];
+                arr[l] = std::move(arr[r]);
+            }
+            arr[r] = std::move(tmp);
+        }
+    }
+
+    /**
+     * @brief Put elements less than the pivot arr[left] to the left part
+     * @returns position of the pivot and true if no element was moved
+     */
+    template <typename T, typename Compare>
+    std::pair<std::size_t, bool> partition_right(std::vector<T> &arr, std::size_t left, std::size_t right,
+                                                 Compare &func) {
+        T pivot = std::move(arr[left]);
+        std::size_t first = left, last = right;
+        // the median of 3 guarantees an element not less than the pivot
+        while (func(arr[++first], pivot));
+        // only the first step needs a border check, afterwards the pivot guards
+        if (first - 1 == left)
+            while (first < last && !func(arr[--last], pivot));
+        else
+            while (!func(arr[--last], pivot));
+
+        bool already_partitioned = first >= last;
+        if (std::is_arithmetic_v<T> && !already_partitioned) {
+            std::swap(arr[first], arr[last]);
+            first++;
+            // BlockQuicksort: remember misplaced elements of a block without branches
+            alignas(64) unsigned char offsets_l[BLOCK_SIZE], offsets_r[BLOCK_SIZE];
+            std::size_t base_l = first, base_r = last;
+            std::size_t num_l = 0, num_r = 0, start_l = 0, start_r = 0;
+            while (first < last) {
+                std::size_t unknown = last - first;
+                std::size_t left_split = num_l == 0 ? (num_r == 0 ? unknown / 2 : unknown) : 0;
+                std::size_t right_split = num_r == 0 ? unknown - left_split : 0;
+                std::size_t block_l = std::min(left_split, BLOCK_SIZE);
+                for (std::size_t i = 0; i < block_l; i++) {
+                    offsets_l[num_l] = (unsigned char) i;
+                    num_l += !func(arr[first], pivot);
+                    first++;
+                }
+                std::size_t block_r = std::min(right_split, BLOCK_SIZE);
+                for (std::size_t i = 0; i < block_r;) {
+                    offsets_r[num_r] = (unsigned char) ++i;
+                    num_r += func(arr[--last], pivot);
+                }
+                std::size_t num = std::min(num_l, num_r);
+                swap_offsets(arr, base_l, base_r, offsets_l + start_l, offsets_r + start_r, num, num_l == num_r);
+                num_l -= num;
+                num_r -= num;
+                start_l += num;
+                start_r += num;
+                if (num_l == 0) {
+                    start_l = 0;
+                    base_l = first;
+                }
+                if (num_r == 0) {
+                    start_r = 0;
+                    base_r = last;
+                }
+            }
+            // one side still has misplaced elements, put them next to the border
+            if (num_l) {
+                while (num_l--)
+                    std::swap(arr[base_l + offsets_l[start_l + num_l]], arr[--last]);
+                first = last;
+            }
+            if (num_r) {
+                while (num_r--)
+                    std::swap(arr[base_r - offsets_r[start_r + num_r]], arr[first]), first++;
+                last = first;
+            }
+        }
+        else {
+            while (first < last) {
+                std::swap(arr[first], arr[last]);
+                while (func(arr[++first], pivot));
+                while (!func(arr[--last], pivot));
+            }
+        }
+        std::size_t pivot_pos = first - 1;
+        arr[left] = std::move(arr[pivot_pos]);
+        arr[pivot_pos] = std::move(pivot);
+        return {pivot_pos, already_partitioned};
+    }
+
+    /**
+     * @brief Sort a range
+     * @param bad_allowed - bad partitions allowed before switching to heap sort
+     * @param leftmost - true if nothing is to the left of the range
+     */
+    template <typename T, typename Compare>
+    void pdq_sort_loop(std::vector<T> &arr, std::size_t left, std::size_t right, Compare &func,
+                       int bad_allowed, bool leftmost) {
+        while (true) {
+            std::size_t size = right - left;
+            if (size < (sorting_network_applies<T, Compare> ? NETWORK_THRESHOLD : INSERTION_SORT_THRESHOLD)) {
+                if (!try_sorting_network(arr, left, right, func))
+                    insertion_sort(arr, left, right, func);
+                return;
+            }
+
+            choose_pivot(arr, left, right, func);
+
+            // pivot equals the element before the range, which is not greater than anything in it
+            if (!leftmost && !func(arr[left - 1], arr[left])) {
+                left = partition_left(arr, left, right, func) + 1;
+                continue;
+            }
+
+            auto [pivot_pos, already_partitioned] = partition_right(arr, left, right, func);
+            std::size_t l_size = pivot_pos - left;
+            std::size_t r_size = right - (pivot_pos + 1);
+            if (l_size < size / 8 || r_size < size / 8) {
+                if (--bad_allowed == 0) {
+                    heap_sort(arr, left, right, func);
+                    return;
+                }
+                // shuffle a few elements to break patterns
+                if (l_size >= INSERTION_SORT_THRESHOLD) {
+                    std::swap(arr[left], arr[left + l_size / 4]);
+                    std::swap(arr[pivot_pos - 1], arr[pivot_pos - l_size / 4]);
+                    if (l_size > NINTHER_THRESHOLD) {
+                        std::swap(arr[left + 1], arr[left + (l_size / 4 + 1)]);
+                        std::swap(arr[left + 2], arr[left + (l_size / 4 + 2)]);
+                        std::swap(arr[pivot_pos - 2], arr[pivot_pos - (l_size / 4 + 1)]);
+                        std::swap(arr[pivot_pos - 3], arr[pivot_pos - (l_size / 4 + 2)]);
+                    }
+                }
+                if (r_size >= INSERTION_SORT_THRESHOLD) {
+                    std::swap(arr[pivot_pos + 1], arr[pivot_pos + (1 + r_size / 4)]);
+                    std::swap(arr[right - 1], arr[right - r_size / 4]);
+                    if (r_size > NINTHER_THRESHOLD) {
+                        std::swap(arr[pivot_pos + 2], arr[pivot_pos + (2 + r_size / 4)]);
+                        std::swap(arr[pivot_pos + 3], arr[pivot_pos + (3 + r_size / 4)]);
+                        std::swap(arr[right - 2], arr[right - (1 + r_size / 4)]);
+                        std::swap(arr[right - 3], arr[right - (2 + r_size / 4)]);
+                    }
+                }
+            }
+            else if (already_partitioned
+                     && partial_insertion_sort(arr, left, pivot_pos, func)
+                     && partial_insertion_sort(arr, pivot_pos + 1, right, func))
+                return;
+
+            // recurse into the left part, loop on the right part
+            pdq_sort_loop(arr, left, pivot_pos, func, bad_allowed, leftmost);
+            left = pivot_pos + 1;
+            leftmost = false;
+        }
+    }
+}
+
+/****************************************************************
+ * @brief Pattern-defeating Quicksort algorithm on a range
+ * @param arr - array to sort
+ * @param left - first index of the range
+ * @param right - index after the last one of the range
+ * @param func - comparison function, true if the first argument goes before the second
+ ****************************************************************/
+template <typename T, typename Compare>
+void pdq_sort(std::vector<T> &arr, std::size_t left, std::size_t right, Compare func) {
+    if (right - left < 2)
+        return;
+    pdq_sort_detail::pdq_sort_loop(arr, left, right, func, std::bit_width(right - left), true);
+}
+
+/****************************************************************
+ * @brief Pattern-defeating Quicksort algorithm
+ * @param arr - array to sort
+ * @param func - comparison function, true if the first argument goes before the second
+ ****************************************************************/
+template <typename T, typename Compare>
+void pdq_sort(std::vector<T> &arr, Compare func) {
+    pdq_sort(arr, 0, arr.size(), func);
+}
+
+/****************************************************************
+ * @brief Pattern-defeating Quicksort algorithm
+ * @param arr - array to sort
+ * @param func - comparison function, true if the first argument goes before the second
+ ****************************************************************/
+template <typename T>
+void pdq_sort(std::vector<T> &arr, bool (*func)(T, T)) {
+    pdq_sort<T, bool (*)(T, T)>(arr, 0, arr.size(), func);
+}
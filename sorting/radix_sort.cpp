@@ -0,0 +1,164 @@
+/****************************************************************
+ * @file
+ * @brief Radix Sort tests and benchmark
+ * @details
+ * Checks radix_sort against std::stable_sort and compares its speed
+ * with std::sort and pdq_sort
+****************************************************************/
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+#include "pdq_sort.h"
+#include "radix_sort.h"
+
+struct Record{
+    std::string name;
+    double score;
+};
+
+/****************************************************************
+ * @brief Measure sorting time
+ * @param arr - array to sort, copied
+ * @param sort - sorting function
+ * @return milliseconds
+ ****************************************************************/
+template <typename T, typename F>
+double measure(std::vector<T> arr, F sort){
+    auto start = std::chrono::steady_clock::now();
+    sort(arr);
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+/****************************************************************
+ * @brief Compare radix_sort with std::stable_sort on random numbers
+ * @param n - array size
+ * @param rng - random generator
+ * @return true if results match
+ ****************************************************************/
+template <typename T>
+bool random_test(int n, std::mt19937_64 &rng){
+    std::vector<T> arr(n);
+    for(auto &x : arr){
+        std::uint64_t r = rng();
+        if constexpr(std::is_floating_point_v<T>)
+            x = (T) ((double) (std::int64_t) r / 1e15);
+        else
+            x = (T) (n % 2 ? r : r % 7);
+    }
+    std::vector<T> expected = arr;
+    std::stable_sort(expected.begin(), expected.end());
+    radix_sort(arr);
+    return arr == expected;
+}
+
+int main(){
+    // region test 1
+    std::vector<int> v1({5, -4, 3, -2, 1, 0});
+    for(auto i: v1)
+        std::cout << i << " ";
+    std::cout << std::endl;
+    radix_sort(v1);
+    for(auto i: v1)
+        std::cout << i << " ";
+    std::cout << std::endl;
+    // endregion
+
+    // region test 2
+    std::vector<double> v2({1.1, -3.5, 2.3, 1123.3, -0.5, 0});
+    for(auto i: v2)
+        std::cout << i << " ";
+    std::cout << std::endl;
+    radix_sort(v2);
+    for(auto i: v2)
+        std::cout << i << " ";
+    std::cout << std::endl;
+    // endregion
+
+    // region test 3
+    std::vector<std::string> v3({"abc", "a", "aaa", "zxc", "", "ab"});
+    for(auto i: v3)
+        std::cout << "\"" << i << "\" ";
+    std::cout << std::endl;
+    radix_sort(v3);
+    for(auto i: v3)
+        std::cout << "\"" << i << "\" ";
+    std::cout << std::endl;
+    // endregion
+
+    // region test 4
+    std::vector<Record> v4({{"bob", 3.5}, {"alice", -1}, {"carol", 3.5}, {"dave", 0}});
+    radix_sort(v4, [](const Record &r){return r.score;});
+    for(auto &r: v4)
+        std::cout << r.name << " " << r.score << ", ";
+    std::cout << std::endl;
+    radix_sort(v4, [](const Record &r) -> const std::string & {return r.name;});
+    for(auto &r: v4)
+        std::cout << r.name << " " << r.score << ", ";
+    std::cout << std::endl;
+    // endregion
+
+    // region random test
+    std::mt19937_64 rng(42);
+    bool ok = true;
+    for(int n = 0; n <= 20000 && ok; n += 1 + n / 2){
+        ok = random_test<std::int32_t>(n, rng) && random_test<std::uint32_t>(n, rng)
+             && random_test<std::int64_t>(n, rng) && random_test<std::int16_t>(n, rng)
+             && random_test<float>(n, rng) && random_test<double>(n, rng);
+        std::vector<std::string> strings(n);
+        for(auto &s : strings){
+            s.resize(rng() % 12);
+            for(auto &c : s)
+                c = (char) (n % 2 ? rng() % 256 : 'a' + rng() % 3);
+        }
+        std::vector<std::string> expected = strings;
+        std::sort(expected.begin(), expected.end());
+        radix_sort(strings);
+        ok = ok && strings == expected;
+    }
+    std::cout << "Random test" << std::endl;
+    if(ok)
+        std::cout << "Random test passed" << std::endl;
+    else
+        std::cout << "Random test failed" << std::endl;
+    std::cout << std::endl;
+    // endregion
+
+    // region benchmark
+    int n = 1 << 22;
+    std::vector<std::uint32_t> keys32(n);
+    std::vector<std::uint64_t> keys64(n);
+    std::vector<float> floats(n);
+    std::vector<std::string> strings(n / 4);
+    for(int i = 0; i < n; i++){
+        keys32[i] = (std::uint32_t) rng();
+        keys64[i] = rng();
+        floats[i] = std::uniform_real_distribution<float>(-1e6, 1e6)(rng);
+    }
+    for(auto &s : strings){
+        s.resize(4 + rng() % 12);
+        for(auto &c : s)
+            c = (char) ('a' + rng() % 26);
+    }
+    auto less = [](const auto &a, const auto &b){return a < b;};
+    std::cout << "Benchmark" << std::endl;
+    std::cout << n << " 32-bit keys: radix_sort " << measure(keys32, [](auto &a){radix_sort(a);})
+              << " ms, pdq_sort " << measure(keys32, [&](auto &a){pdq_sort(a, less);})
+              << " ms, std::sort " << measure(keys32, [](auto &a){std::sort(a.begin(), a.end());}) << " ms" << std::endl;
+    std::cout << n << " 64-bit keys: radix_sort " << measure(keys64, [](auto &a){radix_sort(a);})
+              << " ms, pdq_sort " << measure(keys64, [&](auto &a){pdq_sort(a, less);})
+              << " ms, std::sort " << measure(keys64, [](auto &a){std::sort(a.begin(), a.end());}) << " ms" << std::endl;
+    std::cout << n << " floats: radix_sort " << measure(floats, [](auto &a){radix_sort(a);})
+              << " ms, pdq_sort " << measure(floats, [&](auto &a){pdq_sort(a, less);})
+              << " ms, std::sort " << measure(floats, [](auto &a){std::sort(a.begin(), a.end());}) << " ms" << std::endl;
+    std::cout << strings.size() << " strings: radix_sort " << measure(strings, [](auto &a){radix_sort(a);})
+              << " ms, pdq_sort " << measure(strings, [&](auto &a){pdq_sort(a, less);})
+              << " ms, std::sort " << measure(strings, [](auto &a){std::sort(a.begin(), a.end());}) << " ms" << std::endl;
+    // endregion
+    return 0;
+}
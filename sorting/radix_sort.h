@@ -0,0 +1,186 @@
+/****************************************************************
+ * @file
+ * @brief Radix Sort Algorithm
+ * @details
+ * Radix sort orders elements by the digits of their keys instead of
+ * comparing them. The key of an element is taken by a key function:
+ * 1) Integer and floating point keys are sorted with LSD radix sort.
+ * Keys are mapped to unsigned integers with the same order: the sign bit of
+ * signed integers is flipped, negative floats have all bits flipped.
+ * Digits are 11 bits (8 bits for keys up to 16 bits), the histograms of all
+ * digits are counted in one pass, and passes where every key has the same
+ * digit are skipped. The sort is stable.
+ * 2) String keys are sorted with MSD radix sort in the American flag
+ * variant: elements are permuted into the 256 byte buckets in place,
+ * buckets shorter than 32 elements are finished with insertion_sort.
+ *
+ * ### Complexity
+ * Sort :  O(n * w / d) for LSD, where w is key width and d is digit width
+ * Sort :  O(n * L) for MSD, where L is the average length of distinguishing prefixes
+ * Space Complexity : O(n) for LSD, O(L) for MSD
+****************************************************************/
+
+#pragma once
+
+#include <array>
+#include <bit>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "insertion_sort.h"
+
+namespace radix_sort_detail {
+    constexpr std::size_t MSD_INSERTION_THRESHOLD = 32;  // buckets shorter than this are insertion sorted
+
+    /**
+     * @brief Map a key to an unsigned integer with the same order
+     */
+    template <typename K>
+    auto radix_key(K key) {
+        if constexpr (std::is_same_v<K, bool>)
+            return (std::uint8_t) key;
+        else if constexpr (std::is_floating_point_v<K>) {
+            using U = std::conditional_t<sizeof(K) == 4, std::uint32_t, std::uint64_t>;
+            static_assert(sizeof(K) == sizeof(U), "only float and double keys are supported");
+            U bits = std::bit_cast<U>(key);
+            constexpr U sign = U(1) << (sizeof(U) * CHAR_BIT - 1);
+            return bits & sign ? (U) ~bits : (U) (bits | sign);
+        }
+        else {
+            using U = std::make_unsigned_t<K>;
+            if constexpr (std::is_signed_v<K>)
+                return (U) ((U) key ^ (U(1) << (sizeof(U) * CHAR_BIT - 1)));
+            else
+                return (U) key;
+        }
+    }
+
+    /**
+     * @brief LSD radix sort by numeric keys
+     */
+    template <typename T, typename Key>
+    void lsd_radix_sort(std::vector<T> &arr, Key &key) {
+        using K = std::decay_t<std::invoke_result_t<Key &, const T &>>;
+        using U = decltype(radix_key(std::declval<K>()));
+        constexpr int BITS = sizeof(U) <= 2 ? 8 : 11;
+        constexpr int PASSES = (sizeof(U) * CHAR_BIT + BITS - 1) / BITS;
+        constexpr std::size_t BUCKETS = std::size_t(1) << BITS;
+        constexpr U MASK = (U) (BUCKETS - 1);
+
+        std::size_t n = arr.size();
+        std::vector<std::array<std::size_t, BUCKETS>> counts(PASSES);
+        for (const T &x : arr) {
+            U k = radix_key(key(x));
+            for (int p = 0; p < PASSES; p++)
+                counts[p][(k >> (p * BITS)) & MASK]++;
+        }
+
+        std::vector<T> buffer(n);
+        for (int p = 0; p < PASSES; p++) {
+            auto &count = counts[p];
+            // every key has the same digit, the pass would not move anything
+            if (count[(radix_key(key(arr[0])) >> (p * BITS)) & MASK] == n)
+                continue;
+            std::size_t sum = 0;
+            for (auto &c : count) {
+                std::size_t tmp = c;
+                c = sum;
+                sum += tmp;
+            }
+            for (T &x : arr)
+                buffer[count[(radix_key(key(x)) >> (p * BITS)) & MASK]++] = std::move(x);
+            arr.swap(buffer);
+        }
+    }
+
+    /**
+     * @brief Byte of a string key at a depth
+     * @returns 0 if the string is shorter, byte + 1 otherwise
+     */
+    inline std::size_t bucket(std::string_view s, std::size_t depth) {
+        return depth < s.size() ? (std::size_t) (unsigned char) s[depth] + 1 : 0;
+    }
+
+    /**
+     * @brief MSD (American flag) radix sort by string keys
+     */
+    template <typename T, typename Key>
+    void msd_radix_sort(std::vector<T> &arr, Key &key) {
+        struct Range {
+            std::size_t left, right, depth;
+        };
+        std::vector<Range> stack = {{0, arr.size(), 0}};
+        while (!stack.empty()) {
+            auto [left, right, depth] = stack.back();
+            stack.pop_back();
+            if (right - left < MSD_INSERTION_THRESHOLD) {
+                // keys are equal up to depth, compare only the rest
+                insertion_sort(arr, left, right, [&key, depth](const T &a, const T &b) {
+                    return std::string_view(key(a)).substr(depth) < std::string_view(key(b)).substr(depth);
+                });
+                continue;
+            }
+
+            std::array<std::size_t, 258> next{};
+            for (std::size_t i = left; i < right; i++)
+                next[bucket(key(arr[i]), depth) + 1]++;
+            next[0] = left;
+            for (std::size_t b = 1; b < 258; b++)
+                next[b] += next[b - 1];
+            std::array<std::size_t, 257> end;
+            for (std::size_t b = 0; b < 257; b++)
+                end[b] = next[b + 1];
+
+            // move every element to its bucket by following cycles
+            for (std::size_t b = 0; b < 257; b++) {
+                while (next[b] < end[b]) {
+                    std::size_t target = bucket(key(arr[next[b]]), depth);
+                    while (target != b) {
+                        std::swap(arr[next[b]], arr[next[target]++]);
+                        target = bucket(key(arr[next[b]]), depth);
+                    }
+                    next[b]++;
+                }
+            }
+
+            // bucket 0 holds strings that ended, they are equal
+            std::size_t start = end[0];
+            for (std::size_t b = 1; b < 257; b++) {
+                if (end[b] - start > 1)
+                    stack.push_back({start, end[b], depth + 1});
+                start = end[b];
+            }
+        }
+    }
+}
+
+/****************************************************************
+ * @brief Radix Sort algorithm
+ * @param arr - array to sort
+ * @param key - key function, returns a number or a string for an element
+ ****************************************************************/
+template <typename T, typename Key>
+void radix_sort(std::vector<T> &arr, Key key) {
+    using K = std::decay_t<std::invoke_result_t<Key &, const T &>>;
+    if (arr.size() < 2)
+        return;
+    if constexpr (std::is_arithmetic_v<K>)
+        radix_sort_detail::lsd_radix_sort(arr, key);
+    else {
+        static_assert(std::is_convertible_v<K, std::string_view>, "key must be a number or a string");
+        radix_sort_detail::msd_radix_sort(arr, key);
+    }
+}
+
+/****************************************************************
+ * @brief Radix Sort algorithm by the elements themselves
+ * @param arr - array of numbers or strings to sort
+ ****************************************************************/
+template <typename T>
+void radix_sort(std::vector<T> &arr) {
+    radix_sort(arr, [](const T &x) -> const T & {return x;});
+}
@@ -1,31 +1,11 @@
 /****************************************************************
  * @file
- * @brief Selection Sort Algorithm
- * @details
- * Selection Sort is the sorting algorithm that works by repeatedly
- * finding the minimum element from unsorted part and putting it at the beginning.
- *
- * ### Complexity
- * Sort :  O(n^2)
- * Space Complexity : O(1)
+ * @brief Selection Sort tests
 ****************************************************************/
 
 #include <iostream>
-#include <algorithm>
 #include <vector>
-
-/****************************************************************
- * @brief Selection Sort algorithm
- * @param arr - array to sort
- * @param func - comparison function
- ****************************************************************/
-template <typename T>
-void selection_sort(std::vector<T> &arr, bool (*func)(T, T)) {
-    for(auto i = arr.begin(); i != arr.end(); i++){
-        auto min_el = std::min_element(i, arr.end(), func);
-        std::swap(*i, *min_el);
-    }
-}
+#include "selection_sort.h"
 
 template <typename T>
 bool comp(T a, T b){return a > b;}
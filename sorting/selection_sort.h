@@ -0,0 +1,30 @@
+/****************************************************************
+ * @file
+ * @brief Selection Sort Algorithm
+ * @details
+ * Selection Sort is the sorting algorithm that works by repeatedly
+ * finding the minimum element from unsorted part and putting it at the beginning.
+ *
+ * ### Complexity
+ * Sort :  O(n^2)
+ * Space Complexity : O(1)
+****************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <utility>
+#include <vector>
+
+/****************************************************************
+ * @brief Selection Sort algorithm
+ * @param arr - array to sort
+ * @param func - comparison function
+ ****************************************************************/
+template <typename T>
+void selection_sort(std::vector<T> &arr, bool (*func)(T, T)) {
+    for(auto i = arr.begin(); i != arr.end(); i++){
+        auto min_el = std::min_element(i, arr.end(), func);
+        std::swap(*i, *min_el);
+    }
+}
@@ -0,0 +1,139 @@
+/****************************************************************
+ * @file
+ * @brief SIMD Sorting Network tests and benchmark
+ * @details
+ * Checks sorting_network_sort against std::sort and compares its speed with
+ * insertion_sort on blocks of 4 to 64 elements
+****************************************************************/
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <functional>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <string>
+#include <vector>
+#include "sorting_network.h"
+
+template <typename T>
+bool comp(T a, T b) {return a > b;}
+
+/****************************************************************
+ * @brief Measure time of sorting every block of an array
+ * @param arr - array of blocks, copied
+ * @param block - block size
+ * @param sort - sorting function of a block
+ * @return nanoseconds per block
+ ****************************************************************/
+template <typename T, typename F>
+double measure(std::vector<T> arr, std::size_t block, F sort) {
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t left = 0; left + block <= arr.size(); left += block)
+        sort(arr, left, left + block);
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::nano>(end - start).count() / (double) (arr.size() / block);
+}
+
+int main() {
+    // region test 1
+    std::vector<int> v1({5, 4, 3, 2, 1});
+    for (auto i: v1)
+        std::cout << i << " ";
+    std::cout << std::endl;
+    sorting_network_sort(v1, std::less<>());
+    for (auto i: v1)
+        std::cout << i << " ";
+    std::cout << std::endl;
+    // endregion
+
+    // region test 2
+    std::vector<int> v2;
+    sorting_network_sort(v2, std::less<>());
+    // endregion
+
+    // region test 3
+    std::vector<float> v3({1.1f, -3.5f, 0.0f, -0.0f, 2.3f, std::numeric_limits<float>::infinity(), 1123.3f});
+    for (auto i: v3)
+        std::cout << i << " ";
+    std::cout << std::endl;
+    sorting_network_sort(v3, std::greater<>());
+    for (auto i: v3)
+        std::cout << i << " ";
+    std::cout << std::endl;
+    // endregion
+
+    // region test 4
+    std::vector<std::string> v4({"abc", "a", "aaa", "zxc"});
+    for (auto i: v4)
+        std::cout << i << " ";
+    std::cout << std::endl;
+    sorting_network_sort(v4, comp<std::string>);
+    for (auto i: v4)
+        std::cout << i << " ";
+    std::cout << std::endl;
+    // endregion
+
+    // region random test
+    std::mt19937 rng(42);
+    bool ok = true;
+    for (int n = 0; n <= 64; n++) {
+        for (int range : {2, 100, 1 << 30}) {
+            std::vector<int> arr(n);
+            for (auto &x : arr)
+                x = (int) (rng() % range) - range / 2;
+            std::vector<int> expected = arr;
+            std::sort(expected.begin(), expected.end());
+            sorting_network_sort(arr, std::less<>());
+            ok = ok && arr == expected;
+
+            std::vector<float> floats(n);
+            for (auto &x : floats)
+                x = rng() % 4 == 0 ? (rng() % 2 ? 0.0f : -0.0f) : (float) ((int) (rng() % range) - range / 2) / 7;
+            std::vector<float> expected_floats = floats;
+            std::sort(expected_floats.begin(), expected_floats.end(), std::greater<>());
+            sorting_network_sort(floats, std::greater<>());
+            ok = ok && floats == expected_floats;
+            // zeros of both signs are kept
+            ok = ok && std::count_if(floats.begin(), floats.end(), [](float x) {return x == 0 && std::signbit(x);})
+                       == std::count_if(expected_floats.begin(), expected_floats.end(),
+                                        [](float x) {return x == 0 && std::signbit(x);});
+        }
+    }
+    std::cout << "Random test" << std::endl;
+    if (ok)
+        std::cout << "Random test passed" << std::endl;
+    else
+        std::cout << "Random test failed" << std::endl;
+    std::cout << std::endl;
+    // endregion
+
+    // region benchmark
+    std::size_t n = 1 << 20;
+    std::vector<int> ints(n);
+    std::vector<float> floats(n);
+    for (std::size_t i = 0; i < n; i++) {
+        ints[i] = (int) rng();
+        floats[i] = (float) rng();
+    }
+    std::cout << "Benchmark on blocks of random elements, ns per block" << std::endl;
+    for (std::size_t block : {4, 8, 12, 16, 24, 32, 48, 64}) {
+        double insertion = measure(ints, block, [](std::vector<int> &a, std::size_t l, std::size_t r) {
+            insertion_sort(a, l, r, std::less<>());
+        });
+        double network = measure(ints, block, [](std::vector<int> &a, std::size_t l, std::size_t r) {
+            sorting_network_sort(a, l, r, std::less<>());
+        });
+        double insertion_floats = measure(floats, block, [](std::vector<float> &a, std::size_t l, std::size_t r) {
+            insertion_sort(a, l, r, std::less<>());
+        });
+        double network_floats = measure(floats, block, [](std::vector<float> &a, std::size_t l, std::size_t r) {
+            sorting_network_sort(a, l, r, std::less<>());
+        });
+        std::cout << block << " elements: int insertion_sort " << insertion << ", network " << network
+                  << "; float insertion_sort " << insertion_floats << ", network " << network_floats << std::endl;
+    }
+    // endregion
+    return 0;
+}
@@ -0,0 +1,302 @@
+/****************************************************************
+ * @file
+ * @brief SIMD Sorting Network Algorithm
+ * @details
+ * Sorting networks compare and swap fixed pairs of positions, so the
+ * sequence of operations does not depend on the data and there is nothing
+ * to mispredict. A block of up to 64 32-bit ints or floats is held in up to
+ * 8 AVX2 registers and sorted with a bitonic network: pairs 8 or more
+ * positions apart are vertical min/max of two registers, closer pairs are
+ * a permute, min/max and blend inside a register. The block is padded to
+ * 8, 16, 32 or 64 elements with the largest value.
+ *
+ * Each merge of the network starts with a flip, which compares mirrored
+ * positions, so every comparator sorts in ascending order. Min and max of a
+ * pair return different operands when they are equal, so -0.0 and 0.0 are
+ * both kept.
+ *
+ * The network is used if the CPU supports AVX2, the elements are int32_t or
+ * float (without NaN), and the comparator is std::less or std::greater.
+ * Otherwise blocks are sorted with insertion_sort. pdq_sort uses the
+ * network for its small ranges, so parallel_sort and external_sort, which
+ * sort their chunks with pdq_sort, use it too.
+ *
+ * ### Complexity
+ * Sort :  O(n log^2 n) comparators, n / 8 of them per instruction
+ * Space Complexity : O(1)
+****************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <type_traits>
+#include <vector>
+#include "insertion_sort.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define SORTING_NETWORK_X86 1
+#include <immintrin.h>
+#endif
+
+namespace sorting_network_detail {
+    constexpr std::size_t MAX_BLOCK = 64;  // largest block sorted by the network
+
+    template <typename T>
+    constexpr bool is_network_key = std::is_same_v<T, std::int32_t> || std::is_same_v<T, float>;
+
+    template <typename Compare>
+    constexpr bool is_less = std::is_same_v<Compare, std::less<>> || std::is_same_v<Compare, std::less<int>>
+                             || std::is_same_v<Compare, std::less<float>>;
+
+    template <typename Compare>
+    constexpr bool is_greater = std::is_same_v<Compare, std::greater<>> || std::is_same_v<Compare, std::greater<int>>
+                                || std::is_same_v<Compare, std::greater<float>>;
+
+#ifdef SORTING_NETWORK_X86
+    /**
+     * @brief AVX2 operations on 8 int32_t
+     */
+    struct Int32Ops {
+        using T = std::int32_t;
+        using V = __m256i;
+
+        __attribute__((target("avx2")))
+        static V load(const T *p) {return _mm256_loadu_si256((const __m256i *) p);}
+
+        __attribute__((target("avx2")))
+        static void store(T *p, V v) {_mm256_storeu_si256((__m256i *) p, v);}
+
+        __attribute__((target("avx2")))
+        static V min(V a, V b) {return _mm256_min_epi32(a, b);}
+
+        __attribute__((target("avx2")))
+        static V max(V a, V b) {return _mm256_max_epi32(a, b);}
+
+        __attribute__((target("avx2")))
+        static V permute(V v, __m256i index) {return _mm256_permutevar8x32_epi32(v, index);}
+
+        template <int MASK>
+        __attribute__((target("avx2")))
+        static V blend(V a, V b) {return _mm256_blend_epi32(a, b, MASK);}
+    };
+
+    /**
+     * @brief AVX2 operations on 8 floats
+     */
+    struct FloatOps {
+        using T = float;
+        using V = __m256;
+
+        __attribute__((target("avx2")))
+        static V load(const T *p) {return _mm256_loadu_ps(p);}
+
+        __attribute__((target("avx2")))
+        static void store(T *p, V v) {_mm256_storeu_ps(p, v);}
+
+        __attribute__((target("avx2")))
+        static V min(V a, V b) {return _mm256_min_ps(a, b);}
+
+        __attribute__((target("avx2")))
+        static V max(V a, V b) {return _mm256_max_ps(a, b);}
+
+        __attribute__((target("avx2")))
+        static V permute(V v, __m256i index) {return _mm256_permutevar8x32_ps(v, index);}
+
+        template <int MASK>
+        __attribute__((target("avx2")))
+        static V blend(V a, V b) {return _mm256_blend_ps(a, b, MASK);}
+    };
+
+    /**
+     * @brief Compare lanes of a register with lanes given by a permutation
+     * @details lanes in MASK receive the maximum of their pair, the others the minimum
+     */
+    template <typename Ops, int MASK>
+    __attribute__((target("avx2")))
+    inline typename Ops::V compare_lanes(typename Ops::V v, __m256i index) {
+        // the pair of a lane sees the operands swapped, so equal elements are both kept
+        typename Ops::V p = Ops::permute(v, index);
+        return Ops::template blend<MASK>(Ops::min(v, p), Ops::max(v, p));
+    }
+
+    /**
+     * @brief Half-cleaners with distances 4, 2 and 1 inside every register
+     */
+    template <typename Ops, int R>
+    __attribute__((target("avx2")))
+    inline void clean_lanes(typename Ops::V (&v)[R]) {
+        const __m256i swap4 = _mm256_setr_epi32(4, 5, 6, 7, 0, 1, 2, 3);
+        const __m256i swap2 = _mm256_setr_epi32(2, 3, 0, 1, 6, 7, 4, 5);
+        const __m256i swap1 = _mm256_setr_epi32(1, 0, 3, 2, 5, 4, 7, 6);
+#pragma GCC unroll 8
+        for (int r = 0; r < R; r++) {
+            v[r] = compare_lanes<Ops, 0b11110000>(v[r], swap4);
+            v[r] = compare_lanes<Ops, 0b11001100>(v[r], swap2);
+            v[r] = compare_lanes<Ops, 0b10101010>(v[r], swap1);
+        }
+    }
+
+    /**
+     * @brief Sort 8 * R elements with a bitonic network
+     */
+    template <typename Ops, int R>
+    __attribute__((target("avx2")))
+    void bitonic_sort(typename Ops::T *data) {
+        using V = typename Ops::V;
+        const __m256i reverse = _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+        const __m256i reverse4 = _mm256_setr_epi32(3, 2, 1, 0, 7, 6, 5, 4);
+        const __m256i swap2 = _mm256_setr_epi32(2, 3, 0, 1, 6, 7, 4, 5);
+        const __m256i swap1 = _mm256_setr_epi32(1, 0, 3, 2, 5, 4, 7, 6);
+        V v[R];
+#pragma GCC unroll 8
+        for (int r = 0; r < R; r++)
+            v[r] = Ops::load(data + 8 * r);
+
+        // merges of blocks up to 8 stay inside registers
+#pragma GCC unroll 8
+        for (int r = 0; r < R; r++) {
+            v[r] = compare_lanes<Ops, 0b10101010>(v[r], swap1);
+            v[r] = compare_lanes<Ops, 0b11001100>(v[r], reverse4);
+            v[r] = compare_lanes<Ops, 0b10101010>(v[r], swap1);
+            v[r] = compare_lanes<Ops, 0b11110000>(v[r], reverse);
+            v[r] = compare_lanes<Ops, 0b11001100>(v[r], swap2);
+            v[r] = compare_lanes<Ops, 0b10101010>(v[r], swap1);
+        }
+
+        // merges of blocks of s registers
+#pragma GCC unroll 4
+        for (int s = 2; s <= R; s *= 2) {
+#pragma GCC unroll 8
+            for (int base = 0; base < R; base += s)
+#pragma GCC unroll 4
+                for (int a = 0; a < s / 2; a++) {
+                    V &x = v[base + a], &y = v[base + s - 1 - a];
+                    V mirrored = Ops::permute(y, reverse);
+                    V hi = Ops::max(mirrored, x);
+                    x = Ops::min(x, mirrored);
+                    y = Ops::permute(hi, reverse);
+                }
+#pragma GCC unroll 4
+            for (int d = s / 4; d > 0; d /= 2)
+#pragma GCC unroll 8
+                for (int r = 0; r < R; r++)
+                    if ((r & d) == 0) {
+                        V lo = Ops::min(v[r], v[r + d]);
+                        v[r + d] = Ops::max(v[r + d], v[r]);
+                        v[r] = lo;
+                    }
+            clean_lanes<Ops, R>(v);
+        }
+
+#pragma GCC unroll 8
+        for (int r = 0; r < R; r++)
+            Ops::store(data + 8 * r, v[r]);
+    }
+
+    /**
+     * @brief Check if the CPU supports AVX2
+     */
+    inline bool has_avx2() {
+        static const bool res = [] {
+            __builtin_cpu_init();
+            return __builtin_cpu_supports("avx2");
+        }();
+        return res;
+    }
+#endif
+
+    /**
+     * @brief Sort at most 64 elements in ascending order with the network
+     * @returns false if the network cannot be used, the block is not changed then
+     */
+    template <typename T>
+    bool network_sort(T *data, std::size_t n) {
+#ifdef SORTING_NETWORK_X86
+        if constexpr (is_network_key<T>) {
+            if (n > MAX_BLOCK || !has_avx2())
+                return false;
+            using Ops = std::conditional_t<std::is_same_v<T, float>, FloatOps, Int32Ops>;
+            // NaN is not ordered with anything
+            if constexpr (std::is_same_v<T, float>)
+                for (std::size_t i = 0; i < n; i++)
+                    if (std::isnan(data[i]))
+                        return false;
+            T block[MAX_BLOCK];
+            std::copy_n(data, n, block);
+            std::size_t padded = n <= 8 ? 8 : n <= 16 ? 16 : n <= 32 ? 32 : 64;
+            std::fill(block + n, block + padded, std::numeric_limits<T>::has_infinity
+                                                 ? std::numeric_limits<T>::infinity()
+                                                 : std::numeric_limits<T>::max());
+            if (padded == 8)
+                bitonic_sort<Ops, 1>(block);
+            else if (padded == 16)
+                bitonic_sort<Ops, 2>(block);
+            else if (padded == 32)
+                bitonic_sort<Ops, 4>(block);
+            else
+                bitonic_sort<Ops, 8>(block);
+            std::copy_n(block, n, data);
+            return true;
+        }
+#endif
+        return false;
+    }
+}
+
+/****************************************************************
+ * @brief Check if blocks of an array can be sorted by the network
+ * @details the result for a given type does not depend on the CPU
+ ****************************************************************/
+template <typename T, typename Compare>
+constexpr bool sorting_network_applies = sorting_network_detail::is_network_key<T>
+        && (sorting_network_detail::is_less<Compare> || sorting_network_detail::is_greater<Compare>);
+
+/****************************************************************
+ * @brief Sort a block with the sorting network
+ * @param arr - array to sort
+ * @param left - first index of the block
+ * @param right - index after the last one of the block
+ * @param func - comparison function, std::less or std::greater
+ * @returns false if the network cannot be used, the block is not changed then
+ ****************************************************************/
+template <typename T, typename Compare>
+bool try_sorting_network(std::vector<T> &arr, std::size_t left, std::size_t right, const Compare &) {
+    if constexpr (sorting_network_applies<T, Compare>) {
+        if (!sorting_network_detail::network_sort(arr.data() + left, right - left))
+            return false;
+        if constexpr (sorting_network_detail::is_greater<Compare>)
+            std::reverse(arr.begin() + left, arr.begin() + right);
+        return true;
+    }
+    else
+        return false;
+}
+
+/****************************************************************
+ * @brief Sorting Network algorithm on a block of at most 64 elements
+ * @details falls back to insertion_sort if the network cannot be used
+ * @param arr - array to sort
+ * @param left - first index of the block
+ * @param right - index after the last one of the block
+ * @param func - comparison function, true if the first argument goes before the second
+ ****************************************************************/
+template <typename T, typename Compare>
+void sorting_network_sort(std::vector<T> &arr, std::size_t left, std::size_t right, Compare func) {
+    if (!try_sorting_network(arr, left, right, func))
+        insertion_sort(arr, left, right, func);
+}
+
+/****************************************************************
+ * @brief Sorting Network algorithm on an array of at most 64 elements
+ * @param arr - array to sort
+ * @param func - comparison function, true if the first argument goes before the second
+ ****************************************************************/
+template <typename T, typename Compare>
+void sorting_network_sort(std::vector<T> &arr, Compare func) {
+    sorting_network_sort(arr, 0, arr.size(), func);
+}
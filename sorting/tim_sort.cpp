@@ -0,0 +1,152 @@
+/****************************************************************
+ * @file
+ * @brief TimSort tests and benchmark
+ * @details
+ * Checks tim_sort against std::stable_sort and compares their speed on
+ * random, sorted, reversed and sorted-with-appended-tail inputs
+****************************************************************/
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+#include "pdq_sort.h"
+#include "tim_sort.h"
+
+template <typename T>
+bool comp(T a, T b) {return a > b;}
+
+/****************************************************************
+ * @brief Measure sorting time
+ * @param arr - array to sort, copied
+ * @param sort - sorting function
+ * @return milliseconds
+ ****************************************************************/
+template <typename F>
+double measure(std::vector<int> arr, F sort) {
+    auto start = std::chrono::steady_clock::now();
+    sort(arr);
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count();
+}
+
+int main() {
+    // region test 1
+    std::vector<int> v1({5, 4, 3, 2, 1});
+    for (auto i: v1)
+        std::cout << i << " ";
+    std::cout << std::endl;
+    tim_sort(v1, [](int a, int b) {return a < b;});
+    for (auto i: v1)
+        std::cout << i << " ";
+    std::cout << std::endl;
+    // endregion
+
+    // region test 2
+    std::vector<int> v2;
+    tim_sort(v2, comp);
+    // endregion
+
+    // region test 3
+    std::vector<double> v3({1.1, -3.5, 2.3, 1123.3});
+    for (auto i: v3)
+        std::cout << i << " ";
+    std::cout << std::endl;
+    tim_sort(v3, comp);
+    for (auto i: v3)
+        std::cout << i << " ";
+    std::cout << std::endl;
+    // endregion
+
+    // region test 4
+    std::vector<std::string> v4({"abc", "a", "aaa", "zxc"});
+    for (auto i: v4)
+        std::cout << i << " ";
+    std::cout << std::endl;
+    tim_sort(v4, std::less<>());
+    for (auto i: v4)
+        std::cout << i << " ";
+    std::cout << std::endl;
+    // endregion
+
+    // region random test
+    std::mt19937 rng(42);
+    bool ok = true;
+    auto by_key = [](const std::pair<int, int> &a, const std::pair<int, int> &b) {return a.first < b.first;};
+    for (int n = 0; n <= 20000 && ok; n += 1 + n / 2) {
+        for (int range : {2, 100, 1 << 30}) {
+            for (int pattern = 0; pattern < 4; pattern++) {
+                std::vector<std::pair<int, int>> arr(n);
+                for (int i = 0; i < n; i++)
+                    arr[i] = {(int) (rng() % range), i};
+                // sorted, reversed and sorted with a random tail
+                if (pattern == 1)
+                    std::sort(arr.begin(), arr.end(), by_key);
+                if (pattern == 2)
+                    std::sort(arr.begin(), arr.end(), [](auto &a, auto &b) {return a.first > b.first;});
+                if (pattern == 3)
+                    std::sort(arr.begin(), arr.begin() + n * 9 / 10, by_key);
+                std::vector<std::pair<int, int>> expected = arr;
+                std::stable_sort(expected.begin(), expected.end(), by_key);
+                tim_sort(arr, by_key);
+                ok = ok && arr == expected;
+            }
+        }
+    }
+    // -0.0 and 0.0 are equal but can be told apart, they must keep their order
+    auto same_bits = [](const std::vector<float> &a, const std::vector<float> &b) {
+        return std::memcmp(a.data(), b.data(), a.size() * sizeof(float)) == 0;
+    };
+    for (int n = 0; n <= 300 && ok; n += 1 + n / 4) {
+        std::vector<float> arr(n);
+        for (auto &x : arr)
+            x = std::array<float, 4>{-1.0f, -0.0f, 0.0f, 1.0f}[rng() % 4];
+        std::vector<float> less_arr = arr, less_expected = arr, greater_arr = arr, greater_expected = arr;
+        tim_sort(less_arr, std::less<float>());
+        std::stable_sort(less_expected.begin(), less_expected.end(), std::less<float>());
+        tim_sort(greater_arr, std::greater<float>());
+        std::stable_sort(greater_expected.begin(), greater_expected.end(), std::greater<float>());
+        ok = ok && same_bits(less_arr, less_expected) && same_bits(greater_arr, greater_expected);
+    }
+    std::cout << "Random test" << std::endl;
+    if (ok)
+        std::cout << "Random test passed" << std::endl;
+    else
+        std::cout << "Random test failed" << std::endl;
+    std::cout << std::endl;
+    // endregion
+
+    // region benchmark
+    int n = 1 << 22;
+    std::vector<std::pair<std::string, std::vector<int>>> inputs(5, {"", std::vector<int>(n)});
+    inputs[0].first = "random";
+    inputs[1].first = "sorted";
+    inputs[2].first = "reversed";
+    inputs[3].first = "sorted + 1% random tail";
+    inputs[4].first = "16 sorted batches";
+    for (int i = 0; i < n; i++) {
+        inputs[0].second[i] = (int) rng();
+        inputs[1].second[i] = i;
+        inputs[2].second[i] = n - i;
+        inputs[3].second[i] = i < n / 100 * 99 ? i : (int) (rng() % n);
+        inputs[4].second[i] = (int) (rng() % n);
+    }
+    for (int b = 0; b < 16; b++)
+        std::sort(inputs[4].second.begin() + n / 16 * b, inputs[4].second.begin() + n / 16 * (b + 1));
+    std::cout << "Benchmark on " << n << " ints" << std::endl;
+    for (auto &[name, arr] : inputs) {
+        double tim = measure(arr, [](std::vector<int> &a) {tim_sort(a, std::less<>());});
+        double stable = measure(arr, [](std::vector<int> &a) {std::stable_sort(a.begin(), a.end());});
+        double pdq = measure(arr, [](std::vector<int> &a) {pdq_sort(a, std::less<>());});
+        std::cout << name << ": tim_sort " << tim << " ms, std::stable_sort " << stable << " ms, pdq_sort "
+                  << pdq << " ms" << std::endl;
+    }
+    // endregion
+    return 0;
+}
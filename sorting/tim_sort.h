@@ -0,0 +1,262 @@
+/****************************************************************
+ * @file
+ * @brief TimSort Algorithm
+ * @details
+ * TimSort is a stable merge sort that adapts to existing order:
+ * 1) The array is split into natural runs: maximal non-descending or
+ * strictly descending ranges, the descending ones are reversed.
+ * 2) Runs shorter than minrun (32 to 64) are extended with
+ * binary_insertion_sort. Runs of ints are sorted by sorting_network_sort
+ * where it applies, equal ints cannot be told apart. Floats are not: the
+ * network does not keep the order of -0.0 and 0.0, which compare equal.
+ * 3) Runs are merged by the powersort policy (Munro and Wild): the power of
+ * the border between two runs is the depth at which the border splits
+ * the array in a perfectly balanced merge tree. Runs on the stack are merged
+ * while the border below the top is deeper than the new one, which gives
+ * nearly optimal merge costs.
+ * 4) Before a merge, the elements already in place at the start of the
+ * left run and at the end of the right run are skipped with galloping.
+ * The shorter run is copied to a buffer and merged from its side. When one
+ * run wins several times in a row, the merge gallops: it finds how many
+ * elements win at once with exponential search.
+ *
+ * Sorted, reversed and sorted-with-a-short-tail inputs take O(n).
+ *
+ * ### Complexity
+ * Sort :  O(n log n), O(n + n H) where H is the entropy of run lengths
+ * Space Complexity : O(n)
+****************************************************************/
+
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "binary_insertion_sort.h"
+#include "sorting_network.h"
+
+namespace tim_sort_detail {
+    constexpr std::size_t MIN_GALLOP = 7;  // wins in a row that start galloping
+
+    /**
+     * @brief Length of runs extended with binary insertion sort
+     * @details between 32 and 64, so n / minrun is close to a power of two
+     */
+    inline std::size_t min_run(std::size_t n) {
+        std::size_t r = 0;
+        while (n >= 64) {
+            r |= n & 1;
+            n >>= 1;
+        }
+        return n + r;
+    }
+
+    /**
+     * @brief Find the end of the natural run starting at left, reverse it if it is descending
+     */
+    template <typename T, typename Compare>
+    std::size_t count_run(std::vector<T> &arr, std::size_t left, std::size_t right, Compare &func) {
+        std::size_t i = left + 1;
+        if (i == right)
+            return i;
+        if (func(arr[i], arr[i - 1])) {
+            // strictly descending, so reversing keeps equal elements in order
+            while (i < right && func(arr[i], arr[i - 1]))
+                i++;
+            std::reverse(arr.begin() + left, arr.begin() + i);
+        }
+        else
+            while (i < right && !func(arr[i], arr[i - 1]))
+                i++;
+        return i;
+    }
+
+    /**
+     * @brief Powersort depth of the border between two neighbouring runs
+     * @param left - offset of the first run from the start of the sorted range
+     * @param n1 - length of the first run
+     * @param n2 - length of the second run
+     * @param n - length of the sorted range
+     */
+    inline int node_power(std::size_t left, std::size_t n1, std::size_t n2, std::size_t n) {
+        // doubled midpoints of the runs, bits of a / 2n and b / 2n are compared one by one
+        std::size_t a = 2 * left + n1, b = a + n1 + n2;
+        int power = 0;
+        while (true) {
+            power++;
+            if (a >= n) {
+                a -= n;
+                b -= n;
+            }
+            else if (b >= n)
+                return power;
+            a <<= 1;
+            b <<= 1;
+        }
+    }
+
+    /**
+     * @brief Galloping search for the first element that does not satisfy pred
+     * @details checks positions 0, 1, 3, 7... then runs binary search in the last step
+     */
+    template <typename It, typename Pred>
+    It gallop(It first, It last, Pred pred) {
+        std::ptrdiff_t n = last - first, lo = 0, hi = 0;  // pred holds on [first, first + lo)
+        while (hi < n && pred(first[hi])) {
+            lo = hi + 1;
+            hi = 2 * hi + 1;
+        }
+        return std::partition_point(first + lo, first + std::min(hi, n), pred);
+    }
+
+    /**
+     * @brief Merge [first, mid) and [mid, last), copying the left run to a buffer
+     * @details equal elements of the left run go first
+     */
+    template <typename It, typename T, typename Compare>
+    void merge_lo(It first, It mid, It last, std::vector<T> &buffer, Compare func, std::size_t &min_gallop) {
+        buffer.assign(std::make_move_iterator(first), std::make_move_iterator(mid));
+        auto i = buffer.begin(), i_end = buffer.end();
+        It j = mid, dest = first;
+        while (i != i_end && j != last) {
+            // one element at a time until a run wins min_gallop times in a row
+            // selects instead of branches, so random interleavings are not mispredicted
+            std::size_t streak = 0, limit = min_gallop;
+            bool right_wins = false;
+            while (true) {
+                bool same = func(*j, *i) == right_wins;
+                right_wins ^= !same;
+                *dest++ = std::move(right_wins ? *j : *i);
+                j += right_wins;
+                i += !right_wins;
+                streak = (streak & -(std::size_t) same) + 1;
+                if (i == i_end || j == last || streak >= limit)
+                    break;
+            }
+            if (i == i_end || j == last)
+                break;
+            std::size_t wins1 = right_wins ? 0 : streak, wins2 = right_wins ? streak : 0;
+            // gallop while it moves long stretches, start galloping sooner each time it pays off
+            // and later each time it does not
+            min_gallop++;
+            do {
+                min_gallop -= min_gallop > 1;
+                auto i_next = gallop(i, i_end, [&](const T &x) {return !func(*j, x);});
+                wins1 = i_next - i;
+                dest = std::move(i, i_next, dest);
+                i = i_next;
+                if (i == i_end)
+                    break;
+                It j_next = gallop(j, last, [&](const T &x) {return func(x, *i);});
+                wins2 = j_next - j;
+                dest = std::move(j, j_next, dest);
+                j = j_next;
+            } while (j != last && (wins1 >= MIN_GALLOP || wins2 >= MIN_GALLOP));
+            min_gallop++;
+        }
+        // the rest of the right run is already in place
+        std::move(i, i_end, dest);
+    }
+
+    /**
+     * @brief Merge two neighbouring sorted runs
+     */
+    template <typename T, typename Compare>
+    void merge_runs(std::vector<T> &arr, std::size_t left, std::size_t mid, std::size_t right,
+                    std::vector<T> &buffer, Compare &func, std::size_t &min_gallop) {
+        auto first = arr.begin() + left, middle = arr.begin() + mid, last = arr.begin() + right;
+        // left run elements not greater than the first of the right run are in place
+        first = gallop(first, middle, [&](const T &x) {return !func(*middle, x);});
+        if (first == middle)
+            return;
+        // so are right run elements not less than the last of the left run
+        last = gallop(std::make_reverse_iterator(last), std::make_reverse_iterator(middle),
+                      [&](const T &x) {return !func(x, *(middle - 1));}).base();
+        if (middle - first <= last - middle)
+            merge_lo(first, middle, last, buffer, func, min_gallop);
+        else {
+            // merge from the right end: reversed runs with reversed order, the right run is buffered and wins ties
+            merge_lo(std::make_reverse_iterator(last), std::make_reverse_iterator(middle),
+                     std::make_reverse_iterator(first), buffer,
+                     [&func](const T &a, const T &b) {return func(b, a);}, min_gallop);
+        }
+    }
+}
+
+/****************************************************************
+ * @brief TimSort algorithm on a range
+ * @param arr - array to sort
+ * @param left - first index of the range
+ * @param right - index after the last one of the range
+ * @param func - comparison function, true if the first argument goes before the second
+ ****************************************************************/
+template <typename T, typename Compare>
+void tim_sort(std::vector<T> &arr, std::size_t left, std::size_t right, Compare func) {
+    using namespace tim_sort_detail;
+    std::size_t n = right - left;
+    if (n < 2)
+        return;
+    std::size_t minrun = min_run(n);
+    struct Run {
+        std::size_t start, end;
+        int power;  // power of the border with the previous run on the stack
+    };
+    std::vector<Run> stack;
+    std::vector<T> buffer;
+    std::size_t min_gallop = MIN_GALLOP;
+    for (std::size_t start = left; start < right;) {
+        std::size_t end = count_run(arr, start, right, func);
+        if (end - start < minrun) {
+            std::size_t forced = std::min(right, start + minrun);
+            bool sorted = false;
+            if constexpr (std::is_integral_v<T>)
+                sorted = try_sorting_network(arr, start, forced, func);
+            if (!sorted)
+                binary_insertion_sort(arr, start, end, forced, func);
+            end = forced;
+        }
+        int power = 0;
+        if (!stack.empty()) {
+            Run &top = stack.back();
+            power = node_power(top.start - left, top.end - top.start, end - start, n);
+            // merge runs whose border is deeper in the merge tree than the new one
+            while (stack.size() > 1 && stack.back().power > power) {
+                Run run = stack.back();
+                stack.pop_back();
+                merge_runs(arr, stack.back().start, run.start, run.end, buffer, func, min_gallop);
+                stack.back().end = run.end;
+            }
+        }
+        stack.push_back({start, end, power});
+        start = end;
+    }
+    while (stack.size() > 1) {
+        Run run = stack.back();
+        stack.pop_back();
+        merge_runs(arr, stack.back().start, run.start, run.end, buffer, func, min_gallop);
+        stack.back().end = run.end;
+    }
+}
+
+/****************************************************************
+ * @brief TimSort algorithm
+ * @param arr - array to sort
+ * @param func - comparison function, true if the first argument goes before the second
+ ****************************************************************/
+template <typename T, typename Compare>
+void tim_sort(std::vector<T> &arr, Compare func) {
+    tim_sort(arr, 0, arr.size(), func);
+}
+
+/****************************************************************
+ * @brief TimSort algorithm
+ * @param arr - array to sort
+ * @param func - comparison function, true if the first argument goes before the second
+ ****************************************************************/
+template <typename T>
+void tim_sort(std::vector<T> &arr, bool (*func)(T, T)) {
+    tim_sort<T, bool (*)(T, T)>(arr, 0, arr.size(), func);
+}